@@ -1,142 +1,419 @@
 #include "bmp.h"
 #include "lcd.h"
 #include <time.h>
-
-typedef struct lcd_img_hdr_s
-{
-    int32_t flag;         //file flag, "LVIF"
-    int32_t video_width;  //video width, 1920
-    int32_t video_height; //video height, 1080
-    int32_t lcd_width;    //lcd width, 128
-    int32_t lcd_height;   //lcd height, 64
-    int32_t video_fps;    //video fps, 25
-    int32_t video_frame;  //video frame count, 875
-    int32_t pixel_bit;    //每个像素点所占的bit
-} lcd_img_hdr_t;
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 
 #define IMG_FRAME_DELAY  (24)
 
-#define IMG_HDR_FLAG (0x4649564c) //"LVIF"
-
-#define IMG_HDR_LEN (sizeof(IMG_HDR))
-#define IMG_PIXEL_BIT (8 / IMG_HDR.pixel_bit)
+#define IMG_HDR_LEN (sizeof(lcd_img_hdr_t))
+#define IMG_SIZE_MAX (4096) //大于屏幕的视频用视口(bmp_player_set_view)平移显示
+#define IMG_PIXEL_BIT(hdr) (8 / (hdr)->pixel_bit)
 #if 1 //LED_SIMULATOR_HWTYPE_ST75256
-#define IMG_FRAME_PAGE IMG_HDR.lcd_height
-#define IMG_FRAME_NP IMG_HDR.lcd_width
+#define IMG_FRAME_PAGE(hdr) ((hdr)->lcd_height)
+#define IMG_FRAME_NP(hdr) ((hdr)->lcd_width)
 #else // LED_SIMULATOR_HWTYPE_DEFAULT
-#define IMG_FRAME_PAGE IMG_HDR.lcd_width
-#define IMG_FRAME_NP IMG_HDR.lcd_height
+#define IMG_FRAME_PAGE(hdr) ((hdr)->lcd_width)
+#define IMG_FRAME_NP(hdr) ((hdr)->lcd_height)
 #endif
-#define IMG_FRAME_WIDTH (((IMG_FRAME_PAGE) / IMG_PIXEL_BIT) + ((((IMG_FRAME_PAGE) % IMG_PIXEL_BIT) == 0) ? 0 : 1))
-#define IMG_FRAME_LEN (IMG_FRAME_WIDTH * (IMG_FRAME_NP))
-#define IMG_FILE_LEN (IMG_FRAME_LEN * (IMG_HDR.video_frame))
+#define IMG_FRAME_WIDTH(hdr) (((IMG_FRAME_PAGE(hdr)) / IMG_PIXEL_BIT(hdr)) + ((((IMG_FRAME_PAGE(hdr)) % IMG_PIXEL_BIT(hdr)) == 0) ? 0 : 1))
+#define IMG_FRAME_LEN(hdr) (IMG_FRAME_WIDTH(hdr) * (IMG_FRAME_NP(hdr)))
+#define IMG_FILE_LEN(hdr) ((int64_t)IMG_FRAME_LEN(hdr) * ((hdr)->video_frame)) //超过2GB, 必须用64位计算
+
+/*
+ * 按 pixel_bit 选择的解码器, 打开文件时查表确定, 播放中不再判断格式.
+ * 每种格式用各自专门的拷贝函数, 1bit 视频切换到单色模式, 传输量减半.
+ */
+typedef int32_t (*bmp_blit_fn)(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t stride, int32_t pages,
+                               int32_t sx, int32_t sy, int32_t colour);
+
+struct bmp_decoder_s
+{
+    int32_t pixel_bit; //文件中每个像素的位数
+    int32_t disp_bit;  //显示模式(lcd_set_depth)
+    bmp_blit_fn blit;
+};
 
-FILE *BMP_FILE = NULL;
-int8_t *BMP_FILE_BUFF = NULL;
-lcd_img_hdr_t IMG_HDR = {0};
+static const bmp_decoder_t BMP_DECODER[] =
+{
+    {1, 1, lcd_blitview_mono},
+    {2, 2, lcd_blitview},
+};
 
-lcd_control_t LCD_CTRL_FLAG = 0;
+bmp_player_t *BMP_PLAYER = NULL; //旧接口使用的默认播放器
+
+bmp_overlay_fn BMP_OVERLAY = NULL;
+void *BMP_OVERLAY_ARG = NULL;
+
+static void bmp_debug(const lcd_img_hdr_t *hdr)
+{
+    DEBUG_LOG("video_width[%d]", hdr->video_width);
+    DEBUG_LOG("video_height[%d]", hdr->video_height);
+    DEBUG_LOG("lcd_width[%d]", hdr->lcd_width);
+    DEBUG_LOG("lcd_height[%d]", hdr->lcd_height);
+    DEBUG_LOG("video_fps[%d]", hdr->video_fps);
+    DEBUG_LOG("video_frame[%d]", hdr->video_frame);
+    DEBUG_LOG("pixel_bit[%d]", hdr->pixel_bit);
+
+    DEBUG_LOG("IMG_FRAME_WIDTH[%d]", IMG_FRAME_WIDTH(hdr));
+    DEBUG_LOG("IMG_FRAME_LEN[%d]", IMG_FRAME_LEN(hdr));
+    DEBUG_LOG("IMG_FILE_LEN[%lld]", (long long)IMG_FILE_LEN(hdr));
+}
 
-void bmp_debug(void)
+static int32_t bmp_pread(int32_t fd, void *buf, int64_t len, int64_t offset)
 {
-    DEBUG_LOG("video_width[%d]", IMG_HDR.video_width);
-    DEBUG_LOG("video_height[%d]", IMG_HDR.video_height);
-    DEBUG_LOG("lcd_width[%d]", IMG_HDR.lcd_width);
-    DEBUG_LOG("lcd_height[%d]", IMG_HDR.lcd_height);
-    DEBUG_LOG("video_fps[%d]", IMG_HDR.video_fps);
-    DEBUG_LOG("video_frame[%d]", IMG_HDR.video_frame);
-    DEBUG_LOG("pixel_bit[%d]", IMG_HDR.pixel_bit);
-    DEBUG_LOG("video_fps[%d]", IMG_HDR.video_fps);
+    ssize_t n = 0;
 
-    DEBUG_LOG("IMG_FRAME_WIDTH[%d]", IMG_FRAME_WIDTH);
-    DEBUG_LOG("IMG_FRAME_LEN[%d]", IMG_FRAME_LEN);
-    DEBUG_LOG("IMG_FILE_LEN[%d]", IMG_FILE_LEN);
-    DEBUG_LOG("IMG_FRAME_WIDTH[%d]", IMG_FRAME_WIDTH);
+    while (len > 0)
+    {
+        n = pread(fd, buf, (size_t)len, (off_t)offset);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return ERROR;
+        }
+        if (n == 0)
+        {
+            return ERROR;
+        }
+        buf = (uint8_t *)buf + n;
+        len -= n;
+        offset += n;
+    }
+
+    return OK;
 }
 
-int32_t bmp_init(int8_t *filename)
+static int32_t bmp_load_index(bmp_player_t *player)
 {
-    int32_t hdr_len = 0;
-    int32_t rcnt = 0;
+    lcd_img_idx_t idx = {0};
+    int64_t table_len = 0;
+    int32_t i = 0;
 
-    if (filename == NULL)
+    if (player->file_size < (int64_t)(IMG_HDR_LEN + sizeof(idx)))
     {
         return ERROR;
     }
 
-    BMP_FILE = fopen(filename, "rb");
-    if (BMP_FILE == NULL)
+    if (bmp_pread(player->fd, &idx, sizeof(idx), player->file_size - (int64_t)sizeof(idx)) != OK)
     {
         return ERROR;
     }
 
-    hdr_len = fread(&IMG_HDR, 1, IMG_HDR_LEN, BMP_FILE);
+    if ((idx.flag != IMG_IDX_FLAG) || (idx.frame_count != player->hdr.video_frame))
+    {
+        return ERROR;
+    }
 
-    if (hdr_len != IMG_HDR_LEN)
+    //索引表必须正好位于帧数据之后, 文件末尾之前
+    table_len = (int64_t)idx.frame_count * sizeof(int64_t);
+    if ((idx.table_offset < (int64_t)IMG_HDR_LEN) ||
+        ((idx.table_offset + table_len + (int64_t)sizeof(idx)) != player->file_size))
     {
-        fclose(BMP_FILE);
         return ERROR;
     }
 
-    if (IMG_HDR.flag != IMG_HDR_FLAG)
+    player->frame_idx = malloc(table_len);
+    if (player->frame_idx == NULL)
     {
-        fclose(BMP_FILE);
         return ERROR;
     }
 
-    BMP_FILE_BUFF = malloc(IMG_FILE_LEN);
-    if (BMP_FILE_BUFF == NULL)
+    if (bmp_pread(player->fd, player->frame_idx, table_len, idx.table_offset) != OK)
     {
+        free(player->frame_idx);
+        player->frame_idx = NULL;
         return ERROR;
     }
-    int32_t img_frame_width = IMG_FRAME_WIDTH;
-    int32_t img_frame_size = IMG_FRAME_LEN;
-    int32_t img_file_size = IMG_FILE_LEN;
-    memset(BMP_FILE_BUFF, 0, IMG_FILE_LEN);
-    fseek(BMP_FILE, IMG_HDR_LEN, SEEK_SET);
-    rcnt = fread(BMP_FILE_BUFF, 1, IMG_FILE_LEN, BMP_FILE);
 
-    if (rcnt != IMG_FILE_LEN)
+    for (i = 0; i < idx.frame_count; i++)
+    {
+        if ((player->frame_idx[i] < (int64_t)IMG_HDR_LEN) || ((player->frame_idx[i] + player->frame_len) > idx.table_offset))
+        {
+            DEBUG_LOG("Frame index entry [%d] out of range, ignore index.", i);
+            free(player->frame_idx);
+            player->frame_idx = NULL;
+            return ERROR;
+        }
+    }
+
+    return OK;
+}
+
+/*
+ * bmp_find_decoder:
+ *	按像素位数查找解码器, 不支持的位数返回 NULL.
+ */
+static const bmp_decoder_t *bmp_find_decoder(int32_t pixel_bit)
+{
+    int32_t i = 0;
+
+    for (i = 0; i < (int32_t)(sizeof(BMP_DECODER) / sizeof(BMP_DECODER[0])); i++)
+    {
+        if (BMP_DECODER[i].pixel_bit == pixel_bit)
+        {
+            return &BMP_DECODER[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * bmp_check_hdr:
+ *	检查头部字段, 非法的宽高和像素位数会让帧长计算出错.
+ */
+static int32_t bmp_check_hdr(bmp_player_t *player)
+{
+    lcd_img_hdr_t *hdr = &player->hdr;
+
+    if ((hdr->flag != IMG_HDR_FLAG) || (hdr->video_frame <= 0) || (hdr->video_fps <= 0) ||
+        (hdr->lcd_width <= 0) || (hdr->lcd_width > IMG_SIZE_MAX) || (hdr->lcd_height <= 0) || (hdr->lcd_height > IMG_SIZE_MAX) ||
+        (bmp_find_decoder(hdr->pixel_bit) == NULL))
     {
         return ERROR;
     }
 
-    LCD_CTRL_FLAG = LCD_CTRL_START;
+    return OK;
+}
+
+/*
+ * bmp_check_size:
+ *	头部帧数和实际文件大小对照. 没有索引表时帧数按文件中实际存在的
+ *	完整帧截断(例如还没拷贝完的文件), 有索引表时已在加载时检查过.
+ */
+static int32_t bmp_check_size(bmp_player_t *player)
+{
+    lcd_img_hdr_t *hdr = &player->hdr;
+    int64_t frames = 0;
+
+    if (player->frame_idx != NULL)
+    {
+        return OK;
+    }
+
+    frames = (player->file_size - (int64_t)IMG_HDR_LEN) / player->frame_len;
+    if (frames <= 0)
+    {
+        return ERROR;
+    }
 
-    bmp_debug();
+    if (frames < hdr->video_frame)
+    {
+        DEBUG_LOG("File has only [%lld] of [%d] frames.", (long long)frames, hdr->video_frame);
+        hdr->video_frame = (int32_t)frames;
+    }
 
     return OK;
 }
 
-int32_t bmp_start(void)
+static int64_t bmp_frame_offset(bmp_player_t *player, int32_t frame)
 {
-    LCD_CTRL_FLAG = LCD_CTRL_START;
-    return LCD_CTRL_FLAG;
+    if (player->frame_idx != NULL)
+    {
+        return player->frame_idx[frame];
+    }
+    return (int64_t)IMG_HDR_LEN + (int64_t)frame * player->frame_len;
 }
 
-int32_t bmp_dinit(void)
+static int32_t bmp_read_frame(bmp_player_t *player, int32_t frame)
 {
-    if (BMP_FILE != NULL)
+    if ((frame < 0) || (frame >= player->hdr.video_frame))
     {
-        fclose(BMP_FILE);
-        BMP_FILE = NULL;
+        return ERROR;
     }
 
-    if (BMP_FILE_BUFF != NULL)
+    if (frame == player->buff_frame)
     {
-        free(BMP_FILE_BUFF);
-        BMP_FILE_BUFF = NULL;
+        return OK;
     }
+    player->buff_frame = -1;
 
-    memset(&IMG_HDR, 0, IMG_HDR_LEN);
+    if (bmp_pread(player->fd, player->buff, player->frame_len, bmp_frame_offset(player, frame)) != OK)
+    {
+        return ERROR;
+    }
 
-    LCD_CTRL_FLAG = LCD_CTRL_STOP;
+    player->buff_frame = frame;
+    return OK;
+}
 
-    lcd_clear(LCD_COL_FALSE);
+bmp_player_t *bmp_player_open(int8_t *filename)
+{
+    bmp_player_t *player = NULL;
+    struct stat st;
+
+    if (filename == NULL)
+    {
+        return NULL;
+    }
+
+    player = calloc(1, sizeof(bmp_player_t));
+    if (player == NULL)
+    {
+        return NULL;
+    }
+    player->fd = -1;
+    player->buff_frame = -1;
+
+    player->fd = open(filename, O_RDONLY | O_CLOEXEC);
+    if (player->fd < 0)
+    {
+        bmp_player_close(player);
+        return NULL;
+    }
+
+    if ((fstat(player->fd, &st) != 0) || (bmp_pread(player->fd, &player->hdr, IMG_HDR_LEN, 0) != OK))
+    {
+        bmp_player_close(player);
+        return NULL;
+    }
+    player->file_size = (int64_t)st.st_size;
+
+    if (bmp_check_hdr(player) != OK)
+    {
+        DEBUG_LOG("Invalid header [%s].", filename);
+        bmp_player_close(player);
+        return NULL;
+    }
+
+    player->dec = bmp_find_decoder(player->hdr.pixel_bit);
+
+    //只缓存当前帧, 帧数据按需从文件读取
+    player->frame_len = IMG_FRAME_LEN(&player->hdr);
+    player->buff = calloc(player->frame_len, 1);
+    if (player->buff == NULL)
+    {
+        bmp_player_close(player);
+        return NULL;
+    }
+
+    if (bmp_load_index(player) == OK)
+    {
+        DEBUG_LOG("Frame index loaded [%d] entries.", player->hdr.video_frame);
+    }
+
+    if (bmp_check_size(player) != OK)
+    {
+        DEBUG_LOG("File too short [%s].", filename);
+        bmp_player_close(player);
+        return NULL;
+    }
+
+    player->frame_first = 0;
+    player->frame_last = player->hdr.video_frame - 1;
+    player->frame_next = 0;
+    player->ctrl = LCD_CTRL_START;
+
+    bmp_debug(&player->hdr);
+
+    return player;
+}
+
+int32_t bmp_player_close(bmp_player_t *player)
+{
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    if (player->fd >= 0)
+    {
+        close(player->fd);
+    }
+    free(player->buff);
+    free(player->frame_idx);
+    free(player);
 
     return OK;
 }
 
+int32_t bmp_player_start(bmp_player_t *player)
+{
+    if (player == NULL)
+    {
+        return LCD_CTRL_STOP;
+    }
+
+    player->ctrl = LCD_CTRL_START;
+    return player->ctrl;
+}
+
+/*
+ * bmp_player_seek:
+ *	下一次 bmp_player_step 从指定帧开始显示, 超出播放区间时截断到区间边界.
+ */
+int32_t bmp_player_seek(bmp_player_t *player, int32_t frame)
+{
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    frame = (frame < player->frame_first) ? player->frame_first : ((frame > player->frame_last) ? player->frame_last : frame);
+    player->frame_next = frame;
+    player->ctrl = LCD_CTRL_RUN;
+
+    return OK;
+}
+
+int32_t bmp_player_seek_ms(bmp_player_t *player, int32_t ms)
+{
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    return bmp_player_seek(player, (int32_t)(((int64_t)ms * player->hdr.video_fps) / 1000));
+}
+
+/*
+ * bmp_player_set_range:
+ *	设置播放区间[first, last], last < 0 表示播放到最后一帧.
+ */
+int32_t bmp_player_set_range(bmp_player_t *player, int32_t first, int32_t last)
+{
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    if ((last < 0) || (last >= player->hdr.video_frame))
+    {
+        last = player->hdr.video_frame - 1;
+    }
+
+    if ((first < 0) || (first > last))
+    {
+        return ERROR;
+    }
+
+    player->frame_first = first;
+    player->frame_last = last;
+    player->frame_next = first;
+
+    return OK;
+}
+
+int32_t bmp_player_set_range_ms(bmp_player_t *player, int32_t first_ms, int32_t last_ms)
+{
+    int32_t last = -1;
+
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    if (last_ms >= 0)
+    {
+        last = (int32_t)(((int64_t)last_ms * player->hdr.video_fps) / 1000);
+    }
+
+    return bmp_player_set_range(player, (int32_t)(((int64_t)first_ms * player->hdr.video_fps) / 1000), last);
+}
+
 // 返回自系统开机以来的毫秒数（tick）
 static uint32_t GetTickCount()
 {
@@ -145,71 +422,252 @@ static uint32_t GetTickCount()
     return (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
 }
 
-int32_t bmp_show(int32_t x0, int32_t y0, int32_t colour)
+int32_t bmp_set_overlay(bmp_overlay_fn fn, void *arg)
 {
-    uint8_t *bmp_buff = NULL;
-    static int32_t frame = 0;
+    lcd_lock();
+    BMP_OVERLAY = fn;
+    BMP_OVERLAY_ARG = arg;
+    lcd_unlock();
+    return OK;
+}
+
+/*
+ * bmp_present:
+ *	把一帧页格式的图像送到屏幕, 视频文件和实时流共用.
+ *	先解到显存, 叠加层画完后只发送一次脏区域.
+ */
+int32_t bmp_present(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t colour)
+{
+    lcd_lock();
+    if ((lcd_set_depth(LCD_DRV_COLOUR_BIT) != OK) || (lcd_blitbmp(x0, y0, width, height, bmp, colour) != OK))
+    {
+        lcd_unlock();
+        return ERROR;
+    }
 
-#if 1 //DEBUG
-    int8_t frame_string[100] = {0};
+    if (BMP_OVERLAY != NULL)
+    {
+        BMP_OVERLAY(BMP_OVERLAY_ARG);
+    }
 
-    int32_t img_frame_width = IMG_FRAME_WIDTH;
-    int32_t img_frame_size = IMG_FRAME_LEN;
-    int32_t img_file_size = IMG_FILE_LEN;
-#endif
-    static uint32_t frame_fps0 = 0;
-    static uint32_t frame_fps1 = 0;
-    uint32_t video_fps_delay = 0;
+    lcd_flush();
+    lcd_unlock();
+    return OK;
+}
+
+/*
+ * bmp_player_set_view:
+ *	视口左上角在视频中的位置, 截断到能显示满一屏的范围.
+ */
+int32_t bmp_player_set_view(bmp_player_t *player, int32_t vx, int32_t vy)
+{
+    int32_t max_x = 0, max_y = 0;
 
-    if (BMP_FILE_BUFF == NULL)
+    if (player == NULL)
     {
-        return LCD_CTRL_STOP;
+        return ERROR;
     }
 
-    switch (LCD_CTRL_FLAG)
+    max_x = (player->hdr.lcd_width > LCD_MAX_X) ? (player->hdr.lcd_width - LCD_MAX_X) : 0;
+    max_y = (player->hdr.lcd_height > LCD_MAX_Y) ? (player->hdr.lcd_height - LCD_MAX_Y) : 0;
+    player->view_x = (vx < 0) ? 0 : ((vx > max_x) ? max_x : vx);
+    player->view_y = (vy < 0) ? 0 : ((vy > max_y) ? max_y : vy);
+
+    return OK;
+}
+
+int32_t bmp_player_center_x(bmp_player_t *player)
+{
+    return (player->hdr.lcd_width < LCD_MAX_X) ? (((LCD_MAX_X - player->hdr.lcd_width) / 2) - 1) : 0;
+}
+
+int32_t bmp_player_blit(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour)
+{
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    //从帧缓冲直接拷贝视口内的部分到显存
+    return player->dec->blit(x0, y0, player->hdr.lcd_width - player->view_x, player->hdr.lcd_height - player->view_y,
+                             player->buff, player->hdr.lcd_width, IMG_FRAME_WIDTH(&player->hdr), player->view_x, player->view_y, colour);
+}
+
+int32_t bmp_player_present(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour)
+{
+    lcd_lock();
+    if ((player == NULL) || (lcd_set_depth(player->dec->disp_bit) != OK) || (bmp_player_blit(player, x0, y0, colour) != OK))
+    {
+        lcd_unlock();
+        return ERROR;
+    }
+
+    if (BMP_OVERLAY != NULL)
+    {
+        BMP_OVERLAY(BMP_OVERLAY_ARG);
+    }
+
+    lcd_flush();
+    lcd_unlock();
+    return OK;
+}
+
+int32_t bmp_player_prefetch(bmp_player_t *player, int32_t count)
+{
+    int32_t last = 0;
+
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    last = player->frame_first + count;
+    last = (last > player->frame_last) ? player->frame_last : last;
+    posix_fadvise(player->fd, (off_t)bmp_frame_offset(player, player->frame_first),
+                  (off_t)(last - player->frame_first + 1) * player->frame_len, POSIX_FADV_WILLNEED);
+
+    return bmp_read_frame(player, player->frame_first);
+}
+
+/*
+ * bmp_player_next:
+ *	把下一帧读到 player->buff 并推进播放位置, 不显示也不等待.
+ */
+int32_t bmp_player_next(bmp_player_t *player)
+{
+    int32_t frame = 0;
+    lcd_control_t ctrl = LCD_CTRL_RUN;
+
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    switch (player->ctrl)
     {
     case LCD_CTRL_START:
-        frame = 0;
-        LCD_CTRL_FLAG = LCD_CTRL_RUN;
+        player->frame_next = player->frame_first;
+        player->ctrl = LCD_CTRL_RUN;
         break;
     case LCD_CTRL_RUN:
-        if (frame < (IMG_HDR.video_frame - 1))
-        {
-            frame++;
-        }
-        else
-        {
-            LCD_CTRL_FLAG = LCD_CTRL_STOP;
-        }
         break;
     case LCD_CTRL_STOP:
     default:
-        return LCD_CTRL_STOP;
+        return ERROR;
         break;
     }
 
-    bmp_buff = (BMP_FILE_BUFF + (frame * IMG_FRAME_LEN));
-#if 1 // Center
-    x0 = ((LCD_MAX_X - IMG_HDR.lcd_width) / 2) - 1;
-    // y0 = ((LCD_MAX_Y - IMG_HDR.lcd_height) / 2) - 1;
-#endif
-    if (lcd_putbmpspeed(x0, y0, IMG_HDR.lcd_width, IMG_HDR.lcd_height, bmp_buff, colour) != OK)
+    frame = player->frame_next;
+    if (frame < player->frame_last)
+    {
+        player->frame_next++;
+    }
+    else
+    {
+        ctrl = LCD_CTRL_STOP;
+    }
+
+    if (bmp_read_frame(player, frame) != OK)
+    {
+        player->ctrl = LCD_CTRL_STOP;
+        return ERROR;
+    }
+
+    player->ctrl = ctrl;
+    return OK;
+}
+
+int32_t bmp_player_step(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour)
+{
+    uint32_t tick = 0;
+    uint32_t video_fps_delay = 0;
+
+    if (bmp_player_next(player) != OK)
     {
         return LCD_CTRL_STOP;
     }
 
-    lcd_update();
-    frame_fps1 = GetTickCount();
-    video_fps_delay = (1000 / IMG_HDR.video_fps);
-    if ((frame_fps1 - frame_fps0) < video_fps_delay)
+    if (bmp_player_present(player, x0, y0, colour) != OK)
     {
-        video_fps_delay = (video_fps_delay - (frame_fps1 - frame_fps0) + IMG_FRAME_DELAY);
+        return LCD_CTRL_STOP;
+    }
+
+    tick = GetTickCount();
+    video_fps_delay = (1000 / player->hdr.video_fps);
+    if ((tick - player->tick) < video_fps_delay)
+    {
+        video_fps_delay = (video_fps_delay - (tick - player->tick) + IMG_FRAME_DELAY);
         if(video_fps_delay > 0) 
         {
             DEBUG_LOG("Waiting [%d]ms ...", video_fps_delay);
             delay_xms(video_fps_delay);
         }
     }
-    frame_fps0 = frame_fps1;
-    return LCD_CTRL_FLAG;
+    player->tick = tick;
+    return player->ctrl;
+}
+
+int32_t bmp_init(int8_t *filename)
+{
+    if (BMP_PLAYER != NULL)
+    {
+        bmp_player_close(BMP_PLAYER);
+    }
+
+    BMP_PLAYER = bmp_player_open(filename);
+    return (BMP_PLAYER != NULL) ? OK : ERROR;
+}
+
+int32_t bmp_dinit(void)
+{
+    bmp_player_close(BMP_PLAYER);
+    BMP_PLAYER = NULL;
+
+    lcd_clear(LCD_COL_FALSE);
+
+    return OK;
+}
+
+int32_t bmp_start(void)
+{
+    return bmp_player_start(BMP_PLAYER);
+}
+
+int32_t bmp_seek(int32_t frame)
+{
+    return bmp_player_seek(BMP_PLAYER, frame);
+}
+
+int32_t bmp_seek_ms(int32_t ms)
+{
+    return bmp_player_seek_ms(BMP_PLAYER, ms);
+}
+
+int32_t bmp_set_range(int32_t first, int32_t last)
+{
+    return bmp_player_set_range(BMP_PLAYER, first, last);
+}
+
+int32_t bmp_set_range_ms(int32_t first_ms, int32_t last_ms)
+{
+    return bmp_player_set_range_ms(BMP_PLAYER, first_ms, last_ms);
+}
+
+int32_t bmp_set_view(int32_t vx, int32_t vy)
+{
+    return bmp_player_set_view(BMP_PLAYER, vx, vy);
+}
+
+int32_t bmp_show(int32_t x0, int32_t y0, int32_t colour)
+{
+    if (BMP_PLAYER == NULL)
+    {
+        return LCD_CTRL_STOP;
+    }
+
+#if 1 // Center
+    x0 = bmp_player_center_x(BMP_PLAYER);
+    // y0 = ((LCD_MAX_Y - BMP_PLAYER->hdr.lcd_height) / 2) - 1;
+#endif
+    return bmp_player_step(BMP_PLAYER, x0, y0, colour);
 }
@@ -10,9 +10,176 @@ typedef enum lcd_control_e
     LCD_CTRL_RUN,
 } lcd_control_t;
 
+typedef struct lcd_img_hdr_s
+{
+    int32_t flag;         //file flag, "LVIF"
+    int32_t video_width;  //video width, 1920
+    int32_t video_height; //video height, 1080
+    int32_t lcd_width;    //lcd width, 128
+    int32_t lcd_height;   //lcd height, 64
+    int32_t video_fps;    //video fps, 25
+    int32_t video_frame;  //video frame count, 875
+    int32_t pixel_bit;    //每个像素点所占的bit, 1(单色, 每页8行)或2(4级灰度, 每页4行)
+} lcd_img_hdr_t;
+
+/*
+ * 可选的帧索引表, 追加在文件末尾:
+ * [lcd_img_hdr_t][frame 0]...[frame n-1][int64 offset * n][lcd_img_idx_t]
+ * 没有索引表的文件按固定帧长计算偏移.
+ */
+typedef struct lcd_img_idx_s
+{
+    int32_t flag;         //index flag, "LVIX"
+    int32_t frame_count;  //number of entries in the offset table
+    int64_t table_offset; //file offset of the offset table
+} lcd_img_idx_t;
+
+#define IMG_HDR_FLAG (0x4649564c) //"LVIF"
+#define IMG_IDX_FLAG (0x5849564c) //"LVIX"
+
+typedef struct bmp_decoder_s bmp_decoder_t;
+
+typedef struct bmp_player_s
+{
+    int32_t fd;           //用 pread 按64位偏移读取, 不共享文件位置
+    int64_t file_size;
+    uint8_t *buff;        //当前帧, 帧数据按需从文件读取
+    int32_t buff_frame;   //buff 中是哪一帧, -1 为空
+    int64_t *frame_idx;   //可选的帧索引表
+    lcd_img_hdr_t hdr;
+    const bmp_decoder_t *dec; //按 pixel_bit 选择的解码器
+    int32_t frame_len;    //每帧字节数
+    lcd_control_t ctrl;
+    int32_t frame_first;  //播放区间起始帧
+    int32_t frame_last;   //播放区间结束帧
+    int32_t frame_next;   //下一个要显示的帧
+    uint32_t tick;        //上一帧显示完成的时间(ms)
+    int32_t view_x;       //视口左上角在视频中的位置, 视频大于屏幕时用于平移
+    int32_t view_y;
+} bmp_player_t;
+
+/*****************************************************************************
+函 数 名  : bmp_player_open
+功能描述  : 打开一个视频文件, 所有播放状态保存在返回的句柄中, 多个句柄互不影响
+输入参数  : filename  LVIF文件
+输出参数  : 无
+返 回 值  : 播放器句柄, 失败返回NULL
+*****************************************************************************/
+extern bmp_player_t *bmp_player_open(int8_t *filename);
+extern int32_t bmp_player_close(bmp_player_t *player);
+extern int32_t bmp_player_start(bmp_player_t *player);
+extern int32_t bmp_player_seek(bmp_player_t *player, int32_t frame);
+extern int32_t bmp_player_seek_ms(bmp_player_t *player, int32_t ms);
+extern int32_t bmp_player_set_range(bmp_player_t *player, int32_t first, int32_t last);
+extern int32_t bmp_player_set_range_ms(bmp_player_t *player, int32_t first_ms, int32_t last_ms);
+
+/*****************************************************************************
+函 数 名  : bmp_player_prefetch
+功能描述  : 预读播放区间开头: 第一帧读入 buff, 随后 count 帧提示内核预读,
+            第一次 bmp_player_step 不再等待磁盘. 可在后台线程中调用
+输入参数  : player  播放器句柄
+            count   预读的帧数
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t bmp_player_prefetch(bmp_player_t *player, int32_t count);
+
+/*****************************************************************************
+函 数 名  : bmp_player_next
+功能描述  : 把下一帧读到 player->buff 并推进播放位置, 不显示也不等待,
+            供需要自己合成和调度的调用者使用(如 pip.c)
+输入参数  : player  播放器句柄
+输出参数  : 无
+返 回 值  : OK, 已经播放完毕或读取失败返回 ERROR
+*****************************************************************************/
+extern int32_t bmp_player_next(bmp_player_t *player);
+
+/*****************************************************************************
+函 数 名  : bmp_player_set_view
+功能描述  : 设置视口, 视频大于屏幕时只显示从(vx, vy)开始的一屏, 可在播放中
+            随时修改, vy 不必页对齐
+输入参数  : player  播放器句柄
+            vx, vy  视口左上角在视频中的位置, 超出范围时截断
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t bmp_player_set_view(bmp_player_t *player, int32_t vx, int32_t vy);
+
+/*****************************************************************************
+函 数 名  : bmp_player_center_x
+功能描述  : 视频在屏幕上居中显示时的左上角x坐标, 比屏幕宽的视频从0列开始,
+            用视口选择显示的部分
+输入参数  : player  播放器句柄
+输出参数  : 无
+返 回 值  : x坐标
+*****************************************************************************/
+extern int32_t bmp_player_center_x(bmp_player_t *player);
+
+/*****************************************************************************
+函 数 名  : bmp_player_blit
+功能描述  : 把 player->buff 中视口内的部分写入显存(不发送, 调用者持有 lcd_lock)
+输入参数  : player  播放器句柄
+            x0, y0  显示位置
+            colour  颜色(0-反色)
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t bmp_player_blit(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : bmp_player_present
+功能描述  : 与 bmp_present 相同, 显示 player->buff 中视口内的部分
+输入参数  : player  播放器句柄
+            x0, y0  显示位置
+            colour  颜色(0-反色)
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t bmp_player_present(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : bmp_player_step
+功能描述  : 显示下一帧并按视频帧率等待, 可以在不同线程里驱动不同的句柄
+输入参数  : player  播放器句柄
+            x0, y0  显示位置
+            colour  颜色(0-反色)
+输出参数  : 无
+返 回 值  : LCD_CTRL_RUN, 播放结束返回 LCD_CTRL_STOP
+*****************************************************************************/
+extern int32_t bmp_player_step(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour);
+
+/*
+ * 旧接口, 操作一个进程内默认的播放器.
+ */
 extern int32_t bmp_init(int8_t *filename);
 extern int32_t bmp_dinit(void);
 extern int32_t bmp_start(void);
+extern int32_t bmp_seek(int32_t frame);
+extern int32_t bmp_seek_ms(int32_t ms);
+extern int32_t bmp_set_range(int32_t first, int32_t last);
+extern int32_t bmp_set_range_ms(int32_t first_ms, int32_t last_ms);
+extern int32_t bmp_set_view(int32_t vx, int32_t vy);
 extern int32_t bmp_show(int32_t x0, int32_t y0, int32_t colour);
 
+/*
+ * 叠加层回调, 在每帧写入显存之后、发送之前调用, 可用 lcd_* 画图函数
+ * 在视频上叠加文字等, 画过的区域会随视频帧一起发送.
+ */
+typedef void (*bmp_overlay_fn)(void *arg);
+
+extern int32_t bmp_set_overlay(bmp_overlay_fn fn, void *arg);
+
+/*****************************************************************************
+函 数 名  : bmp_present
+功能描述  : 把一帧页格式的图像写入显存, 叠加后发送一次脏区域. 持有屏幕锁,
+            可在多个线程中调用
+输入参数  : x0, y0          显示位置
+            width, height   图像大小
+            bmp             页格式图像
+            colour          颜色(0-反色)
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t bmp_present(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t colour);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,304 @@
+#include "dither.h"
+#include "gray.h"
+
+//GRAY_NO_SIMD 只用C实现, tools/simd_ref.c 用它生成对比结果
+#if defined(GRAY_NO_SIMD)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DITHER_SIMD_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DITHER_SIMD_SSE2 1
+#endif
+
+#define DITHER_ROW_LEN (16)
+#define DITHER_LEVEL_MAX (3)
+
+/*
+ * 有序抖动阈值表, 每行16字节正好是一个SIMD向量.
+ * 阈值 t 取值[0, 254], 量化级 level = (g * 3 + t) / 255.
+ */
+
+//Bayer 8x8, t = (rank * 2 + 1) * 255 / 128, 每行重复两次
+static const uint8_t DITHER_TBL_BAYER[8][DITHER_ROW_LEN] =
+{
+    {  1, 129,  33, 161,   9, 137,  41, 169,   1, 129,  33, 161,   9, 137,  41, 169},
+    {193,  65, 225,  97, 201,  73, 233, 105, 193,  65, 225,  97, 201,  73, 233, 105},
+    { 49, 177,  17, 145,  57, 185,  25, 153,  49, 177,  17, 145,  57, 185,  25, 153},
+    {241, 113, 209,  81, 249, 121, 217,  89, 241, 113, 209,  81, 249, 121, 217,  89},
+    { 13, 141,  45, 173,   5, 133,  37, 165,  13, 141,  45, 173,   5, 133,  37, 165},
+    {205,  77, 237, 109, 197,  69, 229, 101, 205,  77, 237, 109, 197,  69, 229, 101},
+    { 61, 189,  29, 157,  53, 181,  21, 149,  61, 189,  29, 157,  53, 181,  21, 149},
+    {253, 125, 221,  93, 245, 117, 213,  85, 253, 125, 221,  93, 245, 117, 213,  85},
+};
+
+//16x16 blue noise (void-and-cluster, sigma 1.5), t = (rank * 2 + 1) * 255 / 512
+static const uint8_t DITHER_TBL_BLUE_NOISE[16][DITHER_ROW_LEN] =
+{
+    {233,  50, 187,  19,  58, 170, 121,  47, 162,   1, 246, 104,  22, 131,  14,  65},
+    {208,   8, 118,  97, 239, 204,  23, 227, 137,  64, 123, 169,  72, 223,  99, 148},
+    { 85, 138, 228, 164,  78, 145, 111,  84, 175, 215,  30, 230, 152, 200,  42, 179},
+    { 25,  62, 194,  29,  43, 184,   7, 248,  41, 100, 190,  48,  87,   5, 127, 242},
+    {220, 151, 101, 252, 129, 219,  59, 199, 155,  12, 135, 112, 254, 173,  69, 109},
+    { 46, 188,   0,  73, 171,  90, 141, 116,  80, 236, 209,  61, 146,  33, 205, 159},
+    { 81, 124, 216, 113, 207,  15, 240,  27, 167,  45, 177,  20, 192,  96, 224,  18},
+    {241, 163,  60,  35, 156,  53, 180,  68, 222, 105, 125,  83, 235, 130,  55, 140},
+    {196,  10, 226, 133, 245,  95, 126, 197, 147,   3, 243, 160,  71,   9, 181, 106},
+    { 40,  93, 178,  75, 191,   6, 217,  36,  91,  57, 201,  34, 214, 154, 232,  74},
+    {251, 120, 149,  24, 110,  63, 165, 119, 231, 182, 132, 103,  49, 117,  31, 166},
+    { 16, 211,  51, 237, 206, 136, 253,  21,  76, 150,  13, 249, 189,  88, 202, 134},
+    {102, 183,  82, 168,  38,  89, 186,  52, 203,  98, 172,  67, 128,   4, 221,  56},
+    {229, 143,   2, 127, 225,  11, 153, 114, 238,  39, 218,  28, 234, 144, 174,  77},
+    {195,  37, 247,  70, 107, 198,  66, 176,  17, 142, 115, 158,  86,  44, 108,  26},
+    {122,  92, 157, 213, 139,  32, 244,  94, 212,  79, 193,  54, 210, 185, 250, 161},
+};
+
+static const char *DITHER_NAME[DITHER_MAX] =
+{
+    "none",
+    "bayer",
+    "bluenoise",
+    "fs",
+};
+
+dither_mode_t dither_mode_from_name(const char *name)
+{
+    int32_t i = 0;
+
+    for (i = 0; (name != NULL) && (i < DITHER_MAX); i++)
+    {
+        if (strcmp(name, DITHER_NAME[i]) == 0)
+        {
+            return (dither_mode_t)i;
+        }
+    }
+
+    return DITHER_MAX;
+}
+
+/*
+ * 有序抖动
+ *********************************************************************************
+ */
+static inline uint8_t dither_level(uint8_t g, uint8_t t)
+{
+    uint32_t v = (uint32_t)g * 3 + t;
+    //v / 255, v <= 1019
+    return (uint8_t)(DITHER_LEVEL_MAX - ((v + 1 + (v >> 8)) >> 8));
+}
+
+static void dither_page_ordered_c(const uint8_t *row[4], const uint8_t *thr[4], int32_t x0, int32_t width, uint8_t *dst)
+{
+    int32_t x = 0, r = 0;
+    uint8_t b = 0;
+
+    for (x = x0; x < width; x++)
+    {
+        b = 0;
+        for (r = 0; r < GRAY_PAGE_ROW; r++)
+        {
+            if (row[r] != NULL)
+            {
+                b |= (uint8_t)(dither_level(row[r][x], thr[r][x % DITHER_ROW_LEN]) << ((GRAY_PAGE_ROW - r - 1) * GRAY_PIXEL_BIT));
+            }
+        }
+        dst[x] = b;
+    }
+}
+
+#if DITHER_SIMD_NEON
+static inline uint8x16_t dither_level_neon(uint8x16_t g, uint8x16_t t)
+{
+    uint16x8_t lo = vaddw_u8(vmull_u8(vget_low_u8(g), vdup_n_u8(3)), vget_low_u8(t));
+    uint16x8_t hi = vaddw_u8(vmull_u8(vget_high_u8(g), vdup_n_u8(3)), vget_high_u8(t));
+    uint16x8_t one = vdupq_n_u16(1);
+
+    lo = vshrq_n_u16(vaddq_u16(vaddq_u16(lo, one), vshrq_n_u16(lo, 8)), 8);
+    hi = vshrq_n_u16(vaddq_u16(vaddq_u16(hi, one), vshrq_n_u16(hi, 8)), 8);
+
+    return vsubq_u8(vdupq_n_u8(DITHER_LEVEL_MAX), vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+}
+
+static int32_t dither_page_ordered_simd(const uint8_t *row[4], const uint8_t *thr[4], int32_t width, uint8_t *dst)
+{
+    int32_t x = 0;
+    uint8x16_t t0 = vld1q_u8(thr[0]), t1 = vld1q_u8(thr[1]);
+    uint8x16_t t2 = vld1q_u8(thr[2]), t3 = vld1q_u8(thr[3]);
+    uint8x16_t b;
+
+    for (x = 0; x + DITHER_ROW_LEN <= width; x += DITHER_ROW_LEN)
+    {
+        b = vshlq_n_u8(dither_level_neon(vld1q_u8(row[0] + x), t0), 6);
+        b = vorrq_u8(b, vshlq_n_u8(dither_level_neon(vld1q_u8(row[1] + x), t1), 4));
+        b = vorrq_u8(b, vshlq_n_u8(dither_level_neon(vld1q_u8(row[2] + x), t2), 2));
+        b = vorrq_u8(b, dither_level_neon(vld1q_u8(row[3] + x), t3));
+        vst1q_u8(dst + x, b);
+    }
+
+    return x;
+}
+#elif DITHER_SIMD_SSE2
+static inline __m128i dither_level_sse2(__m128i g, __m128i t)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi16(1);
+    __m128i lo = _mm_unpacklo_epi8(g, zero);
+    __m128i hi = _mm_unpackhi_epi8(g, zero);
+
+    lo = _mm_add_epi16(_mm_add_epi16(lo, _mm_add_epi16(lo, lo)), _mm_unpacklo_epi8(t, zero));
+    hi = _mm_add_epi16(_mm_add_epi16(hi, _mm_add_epi16(hi, hi)), _mm_unpackhi_epi8(t, zero));
+    lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+    hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+
+    return _mm_sub_epi8(_mm_set1_epi8(DITHER_LEVEL_MAX), _mm_packus_epi16(lo, hi));
+}
+
+static int32_t dither_page_ordered_simd(const uint8_t *row[4], const uint8_t *thr[4], int32_t width, uint8_t *dst)
+{
+    int32_t x = 0;
+    __m128i t0 = _mm_loadu_si128((const __m128i *)thr[0]), t1 = _mm_loadu_si128((const __m128i *)thr[1]);
+    __m128i t2 = _mm_loadu_si128((const __m128i *)thr[2]), t3 = _mm_loadu_si128((const __m128i *)thr[3]);
+    __m128i b;
+
+    //level <= 3, 16bit移位不会越过字节边界
+    for (x = 0; x + DITHER_ROW_LEN <= width; x += DITHER_ROW_LEN)
+    {
+        b = _mm_slli_epi16(dither_level_sse2(_mm_loadu_si128((const __m128i *)(row[0] + x)), t0), 6);
+        b = _mm_or_si128(b, _mm_slli_epi16(dither_level_sse2(_mm_loadu_si128((const __m128i *)(row[1] + x)), t1), 4));
+        b = _mm_or_si128(b, _mm_slli_epi16(dither_level_sse2(_mm_loadu_si128((const __m128i *)(row[2] + x)), t2), 2));
+        b = _mm_or_si128(b, dither_level_sse2(_mm_loadu_si128((const __m128i *)(row[3] + x)), t3));
+        _mm_storeu_si128((__m128i *)(dst + x), b);
+    }
+
+    return x;
+}
+#else
+static int32_t dither_page_ordered_simd(const uint8_t *row[4], const uint8_t *thr[4], int32_t width, uint8_t *dst)
+{
+    (void)row;
+    (void)thr;
+    (void)width;
+    (void)dst;
+    return 0;
+}
+#endif
+
+static void dither_ordered(const uint8_t *table, int32_t period, const uint8_t *src, int32_t stride,
+                           int32_t width, int32_t height, uint8_t *dst, int32_t dst_stride)
+{
+    int32_t y = 0, r = 0, x = 0;
+    const uint8_t *row[GRAY_PAGE_ROW];
+    const uint8_t *thr[GRAY_PAGE_ROW];
+
+    for (y = 0; y < height; y += GRAY_PAGE_ROW)
+    {
+        for (r = 0; r < GRAY_PAGE_ROW; r++)
+        {
+            row[r] = ((y + r) < height) ? (src + (size_t)(y + r) * stride) : NULL;
+            thr[r] = table + ((y + r) % period) * DITHER_ROW_LEN;
+        }
+
+        //最后不满一页的行用白色(0)填充
+        x = (row[GRAY_PAGE_ROW - 1] != NULL) ? dither_page_ordered_simd(row, thr, width, dst) : 0;
+        dither_page_ordered_c(row, thr, x, width, dst);
+        dst += dst_stride;
+    }
+}
+
+/*
+ * Floyd-Steinberg 误差扩散, 逐行流水:
+ * 只保留当前行和下一行的误差, 每凑满一页(4行)立即打包输出.
+ *********************************************************************************
+ */
+static int32_t dither_floyd(const uint8_t *src, int32_t stride, int32_t width, int32_t height,
+                            uint8_t *dst, int32_t dst_stride)
+{
+    int16_t *err = NULL, *cur = NULL, *next = NULL, *tmp = NULL;
+    int32_t x = 0, y = 0, r = 0, dir = 0;
+    int32_t v = 0, q = 0, e = 0;
+    const uint8_t *row = NULL;
+
+    //两行误差, 左右各留一个哨兵
+    err = calloc((size_t)(width + 2) * 2, sizeof(int16_t));
+    if (err == NULL)
+    {
+        return ERROR;
+    }
+    cur = err + 1;
+    next = err + (width + 2) + 1;
+
+    for (y = 0; y < height; y++)
+    {
+        row = src + (size_t)y * stride;
+        r = y % GRAY_PAGE_ROW;
+        if (r == 0)
+        {
+            memset(dst, 0, width);
+        }
+
+        //蛇形扫描, 避免误差总往一个方向堆积
+        dir = (y & 1) ? -1 : 1;
+        for (x = (dir > 0) ? 0 : (width - 1); (x >= 0) && (x < width); x += dir)
+        {
+            v = row[x] + ((cur[x] + 8) >> 4);
+            v = (v < 0) ? 0 : ((v > 255) ? 255 : v);
+            q = (v * DITHER_LEVEL_MAX + 127) / 255;
+            e = v - q * (255 / DITHER_LEVEL_MAX);
+
+            cur[x + dir] += (int16_t)(e * 7);
+            next[x - dir] += (int16_t)(e * 3);
+            next[x] += (int16_t)(e * 5);
+            next[x + dir] += (int16_t)e;
+
+            dst[x] |= (uint8_t)((DITHER_LEVEL_MAX - q) << ((GRAY_PAGE_ROW - r - 1) * GRAY_PIXEL_BIT));
+        }
+
+        tmp = cur;
+        cur = next;
+        next = tmp;
+        memset(next - 1, 0, (width + 2) * sizeof(int16_t));
+
+        if ((r == GRAY_PAGE_ROW - 1) || (y == height - 1))
+        {
+            dst += dst_stride;
+        }
+    }
+
+    free(err);
+    return OK;
+}
+
+int32_t dither_2bpp(dither_mode_t mode, const uint8_t *src, int32_t stride, int32_t width, int32_t height,
+                    uint8_t *dst, int32_t dst_stride)
+{
+    int32_t y = 0;
+
+    if ((src == NULL) || (dst == NULL) || (width <= 0) || (height <= 0) || (dst_stride < width))
+    {
+        return ERROR;
+    }
+
+    switch (mode)
+    {
+    case DITHER_NONE:
+        for (y = 0; y < height; y += GRAY_PAGE_ROW)
+        {
+            gray_pack_2bpp(src + (size_t)y * stride, stride, width,
+                           ((height - y) < GRAY_PAGE_ROW) ? (height - y) : GRAY_PAGE_ROW, dst);
+            dst += dst_stride;
+        }
+        break;
+    case DITHER_BAYER:
+        dither_ordered(&DITHER_TBL_BAYER[0][0], 8, src, stride, width, height, dst, dst_stride);
+        break;
+    case DITHER_BLUE_NOISE:
+        dither_ordered(&DITHER_TBL_BLUE_NOISE[0][0], 16, src, stride, width, height, dst, dst_stride);
+        break;
+    case DITHER_FLOYD:
+        return dither_floyd(src, stride, width, height, dst, dst_stride);
+    default:
+        return ERROR;
+    }
+
+    return OK;
+}
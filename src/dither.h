@@ -0,0 +1,41 @@
+#ifndef _LCD_DITHER_H_
+#define _LCD_DITHER_H_
+
+#include "type.h"
+
+typedef enum dither_mode_e
+{
+    DITHER_NONE = 0,    //最近级量化
+    DITHER_BAYER,       //Bayer 8x8 有序抖动
+    DITHER_BLUE_NOISE,  //16x16 蓝噪声有序抖动
+    DITHER_FLOYD,       //Floyd-Steinberg 误差扩散
+    DITHER_MAX,
+} dither_mode_t;
+
+/*****************************************************************************
+函 数 名  : dither_2bpp
+功能描述  : 把8bit灰度图抖动为4级灰度, 直接输出为屏幕的页格式
+            (每字节竖排4个像素, 上方像素在高位, 白色为0, 黑色为3),
+            dst 可以直接指向显存(见 lcd_drv_get_buffer)
+输入参数  : mode        抖动方式
+            src         8bit灰度图
+            stride      src每行的字节数
+            width       图像宽度
+            height      图像高度
+            dst_stride  dst每页的字节数
+输出参数  : dst         页格式数据
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t dither_2bpp(dither_mode_t mode, const uint8_t *src, int32_t stride, int32_t width, int32_t height,
+                           uint8_t *dst, int32_t dst_stride);
+
+/*****************************************************************************
+函 数 名  : dither_mode_from_name
+功能描述  : 由名称("none", "bayer", "bluenoise", "fs")得到抖动方式
+输入参数  : name  名称
+输出参数  : 无
+返 回 值  : 抖动方式, 无效名称返回 DITHER_MAX
+*****************************************************************************/
+extern dither_mode_t dither_mode_from_name(const char *name);
+
+#endif
@@ -0,0 +1,373 @@
+#include "evloop.h"
+#include "lcd.h"
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+#define EVLOOP_SPEED_MIN (0.05)
+#define EVLOOP_SPEED_MAX (16.0)
+
+typedef struct lcd_evloop_src_s
+{
+    int32_t fd;
+    evloop_fn cb;
+    void *arg;
+} lcd_evloop_src_t;
+
+static bmp_player_t *EVLOOP_PLAYER = NULL;
+static int32_t EVLOOP_X0 = 0;
+static int32_t EVLOOP_Y0 = 0;
+static int32_t EVLOOP_COLOUR = 0;
+
+static int32_t EVLOOP_EPFD = -1;
+static int32_t EVLOOP_TFD = -1;
+static int32_t EVLOOP_FIFO_RD = -1;
+static int32_t EVLOOP_FIFO_WR = -1; //保持一个写端, 写命令的进程退出后读端不会一直 EPOLLHUP
+
+static lcd_evloop_src_t EVLOOP_SRC[EVLOOP_FD_MAX];
+static int32_t EVLOOP_SRC_NUM = 0;
+
+static char EVLOOP_LINE[EVLOOP_CMD_LEN] = {0};
+static int32_t EVLOOP_LINE_LEN = 0;
+
+static int32_t EVLOOP_RUN = 0;
+static int32_t EVLOOP_PAUSED = 0;
+static double EVLOOP_SPEED = 1.0;
+static int64_t EVLOOP_DUE_NS = 0; //下一帧的预定时间
+
+static int64_t evloop_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static int64_t evloop_period_ns(void)
+{
+    return (int64_t)(1000000000.0 / (EVLOOP_PLAYER->hdr.video_fps * EVLOOP_SPEED));
+}
+
+/*
+ * evloop_arm:
+ *	Arm the frame timer for EVLOOP_DUE_NS, 0 disarms it (paused).
+ */
+static void evloop_arm(int64_t due_ns)
+{
+    struct itimerspec its = {{0, 0}, {0, 0}};
+
+    if (due_ns > 0)
+    {
+        its.it_value.tv_sec = due_ns / 1000000000;
+        its.it_value.tv_nsec = due_ns % 1000000000;
+    }
+    timerfd_settime(EVLOOP_TFD, TFD_TIMER_ABSTIME, &its, NULL);
+}
+
+static int32_t evloop_show_next(void)
+{
+    if (bmp_player_next(EVLOOP_PLAYER) != OK)
+    {
+        return ERROR;
+    }
+
+    return bmp_player_present(EVLOOP_PLAYER, EVLOOP_X0, EVLOOP_Y0, EVLOOP_COLOUR);
+}
+
+static void evloop_on_timer(void)
+{
+    uint64_t expired = 0;
+    int64_t now = 0;
+
+    if (read(EVLOOP_TFD, &expired, sizeof(expired)) != sizeof(expired))
+    {
+        return;
+    }
+
+    if (EVLOOP_PAUSED)
+    {
+        return;
+    }
+
+    if ((evloop_show_next() != OK) || (EVLOOP_PLAYER->ctrl == LCD_CTRL_STOP))
+    {
+        EVLOOP_RUN = 0;
+        return;
+    }
+
+    //按预定时间推进, 落后超过一帧时从当前时刻重新对齐
+    now = evloop_now_ns();
+    EVLOOP_DUE_NS += evloop_period_ns();
+    if (EVLOOP_DUE_NS < now)
+    {
+        EVLOOP_DUE_NS = now;
+    }
+    evloop_arm(EVLOOP_DUE_NS);
+}
+
+int32_t evloop_command(const char *cmd)
+{
+    double speed = 0;
+    int32_t ms = 0;
+    int32_t vx = 0, vy = 0;
+
+    if ((cmd == NULL) || (EVLOOP_PLAYER == NULL))
+    {
+        return ERROR;
+    }
+
+    if (strcmp(cmd, "pause") == 0)
+    {
+        EVLOOP_PAUSED = 1;
+        evloop_arm(0);
+    }
+    else if (strcmp(cmd, "resume") == 0)
+    {
+        if (EVLOOP_PAUSED)
+        {
+            EVLOOP_PAUSED = 0;
+            EVLOOP_DUE_NS = evloop_now_ns();
+            evloop_arm(EVLOOP_DUE_NS);
+        }
+    }
+    else if (strcmp(cmd, "step") == 0)
+    {
+        //单步只在暂停时有效, 显示下一帧后保持暂停
+        if (EVLOOP_PAUSED && (evloop_show_next() != OK))
+        {
+            return ERROR;
+        }
+    }
+    else if (sscanf(cmd, "speed %lf", &speed) == 1)
+    {
+        if ((speed < EVLOOP_SPEED_MIN) || (speed > EVLOOP_SPEED_MAX))
+        {
+            return ERROR;
+        }
+        //下一帧的时间按新速度从上一帧重新计算, 立即生效
+        EVLOOP_DUE_NS = EVLOOP_DUE_NS - evloop_period_ns();
+        EVLOOP_SPEED = speed;
+        EVLOOP_DUE_NS += evloop_period_ns();
+        if (!EVLOOP_PAUSED)
+        {
+            evloop_arm((EVLOOP_DUE_NS > evloop_now_ns()) ? EVLOOP_DUE_NS : evloop_now_ns());
+        }
+    }
+    else if (sscanf(cmd, "seek %d", &ms) == 1)
+    {
+        if (bmp_player_seek_ms(EVLOOP_PLAYER, ms) != OK)
+        {
+            return ERROR;
+        }
+        //暂停时立即显示目标帧
+        if (EVLOOP_PAUSED && (evloop_show_next() != OK))
+        {
+            return ERROR;
+        }
+    }
+    else if (sscanf(cmd, "view %d %d", &vx, &vy) == 2)
+    {
+        bmp_player_set_view(EVLOOP_PLAYER, vx, vy);
+        //暂停时用当前帧重画视口
+        if (EVLOOP_PAUSED && (EVLOOP_PLAYER->buff_frame >= 0))
+        {
+            bmp_player_present(EVLOOP_PLAYER, EVLOOP_X0, EVLOOP_Y0, EVLOOP_COLOUR);
+        }
+    }
+    else if (strcmp(cmd, "quit") == 0)
+    {
+        EVLOOP_RUN = 0;
+    }
+    else
+    {
+        return ERROR;
+    }
+
+    DEBUG_LOG("Command [%s].", cmd);
+    return OK;
+}
+
+static void evloop_on_fifo(void)
+{
+    char buf[EVLOOP_CMD_LEN] = {0};
+    ssize_t n = 0;
+    int32_t i = 0;
+
+    n = read(EVLOOP_FIFO_RD, buf, sizeof(buf));
+    for (i = 0; i < n; i++)
+    {
+        if ((buf[i] == '\n') || (buf[i] == '\r'))
+        {
+            EVLOOP_LINE[EVLOOP_LINE_LEN] = '\0';
+            if ((EVLOOP_LINE_LEN > 0) && (evloop_command(EVLOOP_LINE) != OK))
+            {
+                DEBUG_LOG("Invalid command [%s].", EVLOOP_LINE);
+            }
+            EVLOOP_LINE_LEN = 0;
+        }
+        else if (EVLOOP_LINE_LEN < (EVLOOP_CMD_LEN - 1))
+        {
+            EVLOOP_LINE[EVLOOP_LINE_LEN++] = buf[i];
+        }
+    }
+}
+
+static int32_t evloop_watch(int32_t fd)
+{
+    struct epoll_event ev = {0};
+
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    return (epoll_ctl(EVLOOP_EPFD, EPOLL_CTL_ADD, fd, &ev) == 0) ? OK : ERROR;
+}
+
+int32_t evloop_init(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour, const char *fifo)
+{
+    if ((player == NULL) || (EVLOOP_EPFD >= 0))
+    {
+        return ERROR;
+    }
+
+    EVLOOP_PLAYER = player;
+    EVLOOP_X0 = x0;
+    EVLOOP_Y0 = y0;
+    EVLOOP_COLOUR = colour;
+    EVLOOP_SRC_NUM = 0;
+    EVLOOP_LINE_LEN = 0;
+    EVLOOP_PAUSED = 0;
+    EVLOOP_SPEED = 1.0;
+
+    EVLOOP_EPFD = epoll_create1(EPOLL_CLOEXEC);
+    EVLOOP_TFD = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if ((EVLOOP_EPFD < 0) || (EVLOOP_TFD < 0) || (evloop_watch(EVLOOP_TFD) != OK))
+    {
+        evloop_dinit();
+        return ERROR;
+    }
+
+    if (fifo != NULL)
+    {
+        if ((mkfifo(fifo, 0666) != 0) && (errno != EEXIST))
+        {
+            evloop_dinit();
+            return ERROR;
+        }
+
+        EVLOOP_FIFO_RD = open(fifo, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        EVLOOP_FIFO_WR = open(fifo, O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+        if ((EVLOOP_FIFO_RD < 0) || (EVLOOP_FIFO_WR < 0) || (evloop_watch(EVLOOP_FIFO_RD) != OK))
+        {
+            evloop_dinit();
+            return ERROR;
+        }
+        DEBUG_LOG("Control fifo [%s].", fifo);
+    }
+
+    return OK;
+}
+
+int32_t evloop_dinit(void)
+{
+    if (EVLOOP_FIFO_RD >= 0)
+    {
+        close(EVLOOP_FIFO_RD);
+        EVLOOP_FIFO_RD = -1;
+    }
+    if (EVLOOP_FIFO_WR >= 0)
+    {
+        close(EVLOOP_FIFO_WR);
+        EVLOOP_FIFO_WR = -1;
+    }
+    if (EVLOOP_TFD >= 0)
+    {
+        close(EVLOOP_TFD);
+        EVLOOP_TFD = -1;
+    }
+    if (EVLOOP_EPFD >= 0)
+    {
+        close(EVLOOP_EPFD);
+        EVLOOP_EPFD = -1;
+    }
+
+    EVLOOP_PLAYER = NULL;
+    EVLOOP_SRC_NUM = 0;
+
+    return OK;
+}
+
+int32_t evloop_add_fd(int32_t fd, evloop_fn cb, void *arg)
+{
+    if ((fd < 0) || (cb == NULL) || (EVLOOP_EPFD < 0) || (EVLOOP_SRC_NUM >= EVLOOP_FD_MAX))
+    {
+        return ERROR;
+    }
+
+    if (evloop_watch(fd) != OK)
+    {
+        return ERROR;
+    }
+
+    EVLOOP_SRC[EVLOOP_SRC_NUM].fd = fd;
+    EVLOOP_SRC[EVLOOP_SRC_NUM].cb = cb;
+    EVLOOP_SRC[EVLOOP_SRC_NUM].arg = arg;
+    EVLOOP_SRC_NUM++;
+
+    return OK;
+}
+
+int32_t evloop_run(void)
+{
+    struct epoll_event ev[EVLOOP_FD_MAX + 2];
+    int32_t n = 0, i = 0, j = 0;
+
+    if (EVLOOP_EPFD < 0)
+    {
+        return ERROR;
+    }
+
+    EVLOOP_RUN = 1;
+    if (!EVLOOP_PAUSED)
+    {
+        EVLOOP_DUE_NS = evloop_now_ns();
+        evloop_arm(EVLOOP_DUE_NS);
+    }
+
+    while (EVLOOP_RUN)
+    {
+        n = epoll_wait(EVLOOP_EPFD, ev, EVLOOP_FD_MAX + 2, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        for (i = 0; (i < n) && EVLOOP_RUN; i++)
+        {
+            if (ev[i].data.fd == EVLOOP_TFD)
+            {
+                evloop_on_timer();
+            }
+            else if (ev[i].data.fd == EVLOOP_FIFO_RD)
+            {
+                evloop_on_fifo();
+            }
+            else
+            {
+                for (j = 0; j < EVLOOP_SRC_NUM; j++)
+                {
+                    if (EVLOOP_SRC[j].fd == ev[i].data.fd)
+                    {
+                        EVLOOP_SRC[j].cb(EVLOOP_SRC[j].fd, EVLOOP_SRC[j].arg);
+                    }
+                }
+            }
+        }
+    }
+
+    evloop_arm(0);
+    EVLOOP_RUN = 0;
+    return OK;
+}
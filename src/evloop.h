@@ -0,0 +1,57 @@
+#ifndef _LCD_EVLOOP_H_
+#define _LCD_EVLOOP_H_
+
+#include "type.h"
+#include "bmp.h"
+
+#define EVLOOP_FD_MAX (8)
+#define EVLOOP_CMD_LEN (128)
+
+typedef void (*evloop_fn)(int32_t fd, void *arg);
+
+/*****************************************************************************
+函 数 名  : evloop_init
+功能描述  : 创建播放事件循环. 帧节拍由 timerfd 产生, 控制命令从 FIFO 读取,
+            循环只在 epoll_wait 中等待, 不会盲目睡眠. 控制命令(每行一条):
+              pause / resume / step / speed X / seek MS / view X Y / quit
+输入参数  : player  播放器句柄, 由调用者打开和关闭
+            x0, y0  显示位置
+            colour  颜色(0-反色)
+            fifo    控制FIFO路径, 不存在时创建, NULL 为不使用
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t evloop_init(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour, const char *fifo);
+extern int32_t evloop_dinit(void);
+
+/*****************************************************************************
+函 数 名  : evloop_add_fd
+功能描述  : 把其他描述符(其他 timerfd, 按键, socket 等)加入循环, 可读时在两帧
+            之间调用 cb, 用于刷新屏幕上的其他内容(须自己 lcd_lock)
+输入参数  : fd   描述符
+            cb   回调
+            arg  回调参数
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t evloop_add_fd(int32_t fd, evloop_fn cb, void *arg);
+
+/*****************************************************************************
+函 数 名  : evloop_command
+功能描述  : 执行一条控制命令, 与从FIFO收到的命令相同
+输入参数  : cmd  命令, 例如 "speed 0.5", "seek 12000"
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t evloop_command(const char *cmd);
+
+/*****************************************************************************
+函 数 名  : evloop_run
+功能描述  : 运行事件循环, 播放结束或收到 quit 后返回
+输入参数  : 无
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t evloop_run(void);
+
+#endif
@@ -1,5 +1,8 @@
 #include "font.h"
 
+//FONT_PACKED 为1时使用 font_packed.c 中由这里的点阵生成的压缩字库
+#if !FONT_PACKED
+
 
 const uint8 FONT_EN_8X16[/*95][16*/] =
 {
@@ -8775,6 +8778,10 @@ font_t LED_FONT[FONT_MAX] =
     { FONT_17X24, 17, 24, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_17X24 },
 };
 
+#else
+extern font_t LED_FONT[FONT_MAX];
+#endif
+
 font_t* font_get(uint8_t fidx)
 {
     fidx = ((fidx >= FONT_MAX) ? FONT_17X24 : fidx);
@@ -16,6 +16,21 @@ typedef enum font_name_e
     FONT_MIN = 0,
 } font_name_t;
 
+/*
+ * 1 使用 tools/font_pack.c 生成的压缩字库(font_packed.c), 0 使用 font.c 中
+ * 的原始点阵. 重新生成压缩字库时 font.c 需要用 -DFONT_PACKED=0 编译.
+ */
+#ifndef FONT_PACKED
+#define FONT_PACKED 1
+#endif
+
+/*
+ * 原始点阵: pdata 中每个字符 height 行, 每行 (width + 7) / 8 字节, 高位在左.
+ * 压缩字库: 去掉上下的空行, 其余每行存为行表 rows 中的行号. pdata 为字形记录
+ * [第一个非空行][行数][行号 * 行数], 行号在行表超过256行时为2字节(低位在前),
+ * offset 为每个字符的记录在 pdata 中的位置. 压缩后不变小的字体 offset 为 NULL,
+ * pdata 仍为原始点阵.
+ */
 typedef struct font_s
 {
     int32  name;
@@ -24,11 +39,51 @@ typedef struct font_s
     int8  cmin;
     int8  cmax;
     uint8* pdata;
+#if FONT_PACKED
+    const uint8 *rows;
+    const uint16 *offset;
+    int32  wide;     //行号为2字节
+#endif
 } font_t;
 
 #define FNT_EN_ASCII_MIN ' '//32  -- 0
 #define FNT_EN_ASCII_MAX '~'//126 -- 94
 
+//最大字体的宽高, 按字体大小分配缓冲的地方使用, 增加更大的字体时需要修改
+#define FONT_WIDTH_MAX (17)
+#define FONT_HEIGHT_MAX (24)
+
 extern font_t* font_get(uint8_t fidx);
 
+/*
+ * font_glyph_row:
+ *	第 idx 个字符第 row 行的点阵, 直接指向字库, 不需要解码缓冲
+ */
+static inline const uint8 *font_glyph_row(const font_t *pfont, int32 idx, int32 row)
+{
+    int32 wbyte = (pfont->width + 7) / 8;
+#if FONT_PACKED
+    static const uint8 blank[4] = {0};
+    const uint8 *rec = NULL;
+    int32 n = 0;
+
+    if (pfont->offset == NULL)
+    {
+        return pfont->pdata + (idx * pfont->height + row) * wbyte;
+    }
+
+    rec = pfont->pdata + pfont->offset[idx];
+    n = row - rec[0];
+    if ((n < 0) || (n >= rec[1]))
+    {
+        return blank;
+    }
+
+    n = pfont->wide ? (rec[2 + n * 2] | (rec[3 + n * 2] << 8)) : rec[2 + n];
+    return pfont->rows + n * wbyte;
+#else
+    return pfont->pdata + (idx * pfont->height + row) * wbyte;
+#endif
+}
+
 #endif
\ No newline at end of file
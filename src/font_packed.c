@@ -0,0 +1,2087 @@
+/*
+ * font_packed.c:
+ *	Generated by tools/font_pack.c from the bitmaps in font.c, do not edit.
+ */
+#include "font.h"
+
+#if FONT_PACKED
+
+const uint8 FONT_EN_5X7[] =
+{
+    /*" ",0*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"!",1*/
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,
+    /*""",2*/
+    0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00,
+    /*"#",3*/
+    0x50, 0x50, 0xF8, 0x50, 0xF8, 0x50, 0x50,
+    /*"$",4*/
+    0x20, 0x78, 0xA0, 0x70, 0x28, 0xF0, 0x20,
+    /*"%",5*/
+    0xC0, 0xC8, 0x10, 0x20, 0x40, 0x98, 0x18,
+    /*"&",6*/
+    0x60, 0x90, 0xA0, 0x40, 0xA8, 0x90, 0x68,
+    /*"'",7*/
+    0x60, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,
+    /*"(",8*/
+    0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10,
+    /*")",9*/
+    0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40,
+    /*"*",10*/
+    0x00, 0x50, 0x20, 0xF8, 0x20, 0x50, 0x00,
+    /*"+",11*/
+    0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00,
+    /*",",12*/
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x40,
+    /*"-",13*/
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    /*".",14*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60,
+    /*"/",15*/
+    0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00,
+    /*"0",16*/
+    0x70, 0x88, 0x98, 0xA8, 0xC8, 0x88, 0x70,
+    /*"1",17*/
+    0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70,
+    /*"2",18*/
+    0x70, 0x88, 0x08, 0x10, 0x20, 0x40, 0xF8,
+    /*"3",19*/
+    0xF8, 0x10, 0x20, 0x10, 0x08, 0x88, 0x70,
+    /*"4",20*/
+    0x10, 0x30, 0x50, 0x90, 0xF8, 0x10, 0x10,
+    /*"5",21*/
+    0xF8, 0x80, 0xF0, 0x08, 0x08, 0x88, 0x70,
+    /*"6",22*/
+    0x30, 0x40, 0x80, 0xF0, 0x88, 0x88, 0x70,
+    /*"7",23*/
+    0xF8, 0x08, 0x10, 0x20, 0x40, 0x40, 0x40,
+    /*"8",24*/
+    0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70,
+    /*"9",25*/
+    0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0x60,
+    /*":",26*/
+    0x00, 0x60, 0x60, 0x00, 0x60, 0x60, 0x00,
+    /*";",27*/
+    0x00, 0x60, 0x60, 0x00, 0x60, 0x20, 0x40,
+    /*"<",28*/
+    0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08,
+    /*"=",29*/
+    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00,
+    /*">",30*/
+    0x80, 0x40, 0x20, 0x10, 0x20, 0x40, 0x80,
+    /*"?",31*/
+    0x70, 0x88, 0x08, 0x10, 0x20, 0x00, 0x20,
+    /*"@",32*/
+    0x70, 0x88, 0x08, 0x68, 0xA8, 0xA8, 0x70,
+    /*"A",33*/
+    0x70, 0x88, 0x88, 0x88, 0xF8, 0x88, 0x88,
+    /*"B",34*/
+    0xF0, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0,
+    /*"C",35*/
+    0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70,
+    /*"D",36*/
+    0xE0, 0x90, 0x88, 0x88, 0x88, 0x90, 0xE0,
+    /*"E",37*/
+    0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0xF8,
+    /*"F",38*/
+    0xF8, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x80,
+    /*"G",39*/
+    0x70, 0x88, 0x80, 0x80, 0x98, 0x88, 0x70,
+    /*"H",40*/
+    0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88,
+    /*"I",41*/
+    0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+    /*"J",42*/
+    0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60,
+    /*"K",43*/
+    0x88, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x88,
+    /*"L",44*/
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8,
+    /*"M",45*/
+    0x88, 0xD8, 0xA8, 0x88, 0x88, 0x88, 0x88,
+    /*"N",46*/
+    0x88, 0x88, 0xC8, 0xA8, 0x98, 0x88, 0x88,
+    /*"O",47*/
+    0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,
+    /*"P",48*/
+    0xF0, 0x88, 0x88, 0xF0, 0x80, 0x80, 0x80,
+    /*"Q",49*/
+    0x70, 0x88, 0x88, 0x88, 0xA8, 0x90, 0x68,
+    /*"R",50*/
+    0xF0, 0x88, 0x88, 0xF0, 0xA0, 0x90, 0x88,
+    /*"S",51*/
+    0x78, 0x80, 0x80, 0x70, 0x08, 0x08, 0xF0,
+    /*"T",52*/
+    0xF8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    /*"U",53*/
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,
+    /*"V",54*/
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20,
+    /*"W",55*/
+    0x88, 0x88, 0x88, 0xA8, 0xA8, 0xD8, 0x88,
+    /*"X",56*/
+    0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88,
+    /*"Y",57*/
+    0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20,
+    /*"Z",58*/
+    0xF8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xF8,
+    /*"[",59*/
+    0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38,
+    /*"\",60*/
+    0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00,
+    /*"]",61*/
+    0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0xE0,
+    /*"^",62*/
+    0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00,
+    /*"_",63*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    /*"`",64*/
+    0x40, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,
+    /*"a",65*/
+    0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78,
+    /*"b",66*/
+    0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0xF0,
+    /*"c",67*/
+    0x00, 0x00, 0x70, 0x80, 0x80, 0x88, 0x70,
+    /*"d",68*/
+    0x08, 0x08, 0x68, 0x98, 0x88, 0x88, 0x78,
+    /*"e",69*/
+    0x00, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x70,
+    /*"f",70*/
+    0x30, 0x48, 0x40, 0xE0, 0x40, 0x40, 0x40,
+    /*"g",71*/
+    0x00, 0x00, 0x78, 0x88, 0x78, 0x08, 0x30,
+    /*"h",72*/
+    0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88,
+    /*"i",73*/
+    0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70,
+    /*"j",74*/
+    0x10, 0x00, 0x30, 0x10, 0x10, 0x90, 0x60,
+    /*"k",75*/
+    0x40, 0x40, 0x48, 0x50, 0x60, 0x50, 0x48,
+    /*"l",76*/
+    0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+    /*"m",77*/
+    0x00, 0x00, 0xD0, 0xA8, 0xA8, 0x88, 0x88,
+    /*"n",78*/
+    0x00, 0x00, 0xB0, 0xC8, 0x88, 0x88, 0x88,
+    /*"o",79*/
+    0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70,
+    /*"p",80*/
+    0x00, 0x00, 0xF0, 0x88, 0xF0, 0x80, 0x80,
+    /*"q",81*/
+    0x00, 0x00, 0x68, 0x98, 0x78, 0x08, 0x08,
+    /*"r",82*/
+    0x00, 0x00, 0xB0, 0xC8, 0x80, 0x80, 0x80,
+    /*"s",83*/
+    0x00, 0x00, 0x70, 0x80, 0x70, 0x08, 0xF0,
+    /*"t",84*/
+    0x40, 0x40, 0xE0, 0x40, 0x40, 0x48, 0x30,
+    /*"u",85*/
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68,
+    /*"v",86*/
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20,
+    /*"w",87*/
+    0x00, 0x00, 0x88, 0x88, 0xA8, 0xA8, 0x50,
+    /*"x",88*/
+    0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88,
+    /*"y",89*/
+    0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x70,
+    /*"z",90*/
+    0x00, 0x00, 0xF8, 0x10, 0x20, 0x40, 0xF8,
+    /*"{",91*/
+    0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10,
+    /*"|",92*/
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    /*"}",93*/
+    0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40,
+    /*"~",94*/
+    0x00, 0x20, 0x10, 0xF8, 0x10, 0x20, 0x00,
+};
+
+const uint8 FONT_EN_5X8[] =
+{
+    /*" ",0*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"!",1*/
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    /*""",2*/
+    0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"#",3*/
+    0x28, 0x50, 0xF8, 0x50, 0xF8, 0x50, 0xA0, 0x00,
+    /*"$",4*/
+    0x20, 0x30, 0x60, 0x30, 0x10, 0x60, 0x20, 0x00,
+    /*"%",5*/
+    0x20, 0x20, 0x18, 0x60, 0x10, 0x10, 0x00, 0x00,
+    /*"&",6*/
+    0x00, 0x38, 0x20, 0x60, 0x50, 0x78, 0x00, 0x00,
+    /*"'",7*/
+    0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"(",8*/
+    0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x00,
+    /*")",9*/
+    0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x40, 0x00,
+    /*"*",10*/
+    0x20, 0x70, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00,
+    /*"+",11*/
+    0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0x00,
+    /*",",12*/
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x20, 0x00,
+    /*"-",13*/
+    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+    /*".",14*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+    /*"/",15*/
+    0x10, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x00,
+    /*"0",16*/
+    0x20, 0x50, 0x50, 0x50, 0x50, 0x20, 0x00, 0x00,
+    /*"1",17*/
+    0x60, 0x20, 0x20, 0x20, 0x20, 0xF8, 0x00, 0x00,
+    /*"2",18*/
+    0x20, 0x50, 0x20, 0x20, 0x40, 0x70, 0x00, 0x00,
+    /*"3",19*/
+    0x20, 0x50, 0x10, 0x20, 0x10, 0x60, 0x00, 0x00,
+    /*"4",20*/
+    0x10, 0x30, 0x50, 0x78, 0x10, 0x38, 0x00, 0x00,
+    /*"5",21*/
+    0x70, 0x40, 0x60, 0x10, 0x50, 0x20, 0x00, 0x00,
+    /*"6",22*/
+    0x30, 0x40, 0x60, 0x50, 0x50, 0x60, 0x00, 0x00,
+    /*"7",23*/
+    0x70, 0x50, 0x10, 0x20, 0x20, 0x20, 0x00, 0x00,
+    /*"8",24*/
+    0x20, 0x50, 0x20, 0x50, 0x50, 0x20, 0x00, 0x00,
+    /*"9",25*/
+    0x30, 0x50, 0x50, 0x30, 0x10, 0x60, 0x00, 0x00,
+    /*":",26*/
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00,
+    /*";",27*/
+    0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x00, 0x00,
+    /*"<",28*/
+    0x00, 0x10, 0x20, 0xC0, 0x20, 0x10, 0x00, 0x00,
+    /*"=",29*/
+    0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
+    /*">",30*/
+    0x00, 0x40, 0x20, 0x18, 0x20, 0x40, 0x00, 0x00,
+    /*"?",31*/
+    0x20, 0x50, 0x10, 0x20, 0x00, 0x20, 0x00, 0x00,
+    /*"@",32*/
+    0x30, 0x48, 0x48, 0x58, 0x48, 0x40, 0x38, 0x00,
+    /*"A",33*/
+    0x60, 0x20, 0x50, 0x70, 0x88, 0xD8, 0x00, 0x00,
+    /*"B",34*/
+    0xF0, 0x48, 0x70, 0x48, 0x48, 0xF0, 0x00, 0x00,
+    /*"C",35*/
+    0x70, 0x50, 0x40, 0x40, 0x40, 0x30, 0x00, 0x00,
+    /*"D",36*/
+    0xF0, 0x48, 0x48, 0x48, 0x48, 0xF0, 0x00, 0x00,
+    /*"E",37*/
+    0xF8, 0x48, 0x60, 0x40, 0x48, 0xF8, 0x00, 0x00,
+    /*"F",38*/
+    0xF8, 0x48, 0x60, 0x40, 0x40, 0xE0, 0x00, 0x00,
+    /*"G",39*/
+    0x70, 0x40, 0x40, 0x58, 0x50, 0x30, 0x00, 0x00,
+    /*"H",40*/
+    0xE8, 0x48, 0x78, 0x48, 0x48, 0xE8, 0x00, 0x00,
+    /*"I",41*/
+    0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    /*"J",42*/
+    0x38, 0x10, 0x10, 0x50, 0x50, 0x20, 0x00, 0x00,
+    /*"K",43*/
+    0xD8, 0x50, 0x60, 0x70, 0x50, 0xD8, 0x00, 0x00,
+    /*"L",44*/
+    0xE0, 0x40, 0x40, 0x40, 0x48, 0xF8, 0x00, 0x00,
+    /*"M",45*/
+    0xD8, 0xD8, 0xD8, 0xA8, 0x88, 0xD8, 0x00, 0x00,
+    /*"N",46*/
+    0xD8, 0x68, 0x68, 0x58, 0x58, 0xE8, 0x00, 0x00,
+    /*"O",47*/
+    0x30, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    /*"P",48*/
+    0xF0, 0x48, 0x48, 0x70, 0x40, 0xE0, 0x00, 0x00,
+    /*"Q",49*/
+    0x30, 0x48, 0x48, 0x48, 0x48, 0x30, 0x18, 0x00,
+    /*"R",50*/
+    0xF0, 0x48, 0x48, 0x70, 0x48, 0xE8, 0x00, 0x00,
+    /*"S",51*/
+    0x70, 0x50, 0x20, 0x10, 0x50, 0x70, 0x00, 0x00,
+    /*"T",52*/
+    0xF8, 0xA8, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    /*"U",53*/
+    0xD8, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    /*"V",54*/
+    0xD8, 0x88, 0x48, 0x50, 0x50, 0x30, 0x00, 0x00,
+    /*"W",55*/
+    0xD8, 0x88, 0xA8, 0xA8, 0xA8, 0x50, 0x00, 0x00,
+    /*"X",56*/
+    0xD8, 0x50, 0x20, 0x20, 0x50, 0xD8, 0x00, 0x00,
+    /*"Y",57*/
+    0xD8, 0x88, 0x50, 0x20, 0x20, 0x70, 0x00, 0x00,
+    /*"Z",58*/
+    0x78, 0x48, 0x10, 0x20, 0x48, 0x78, 0x00, 0x00,
+    /*"[",59*/
+    0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x00,
+    /*"\",60*/
+    0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x10, 0x00,
+    /*"]",61*/
+    0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x00,
+    /*"^",62*/
+    0x20, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"_",63*/
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    /*"`",64*/
+    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"a",65*/
+    0x00, 0x00, 0x30, 0x10, 0x70, 0x78, 0x00, 0x00,
+    /*"b",66*/
+    0xC0, 0x40, 0x70, 0x48, 0x48, 0xF0, 0x00, 0x00,
+    /*"c",67*/
+    0x00, 0x00, 0x70, 0x40, 0x40, 0x70, 0x00, 0x00,
+    /*"d",68*/
+    0x18, 0x08, 0x38, 0x48, 0x48, 0x38, 0x00, 0x00,
+    /*"e",69*/
+    0x00, 0x00, 0x70, 0x70, 0x40, 0x30, 0x00, 0x00,
+    /*"f",70*/
+    0x10, 0x20, 0x70, 0x20, 0x20, 0x70, 0x00, 0x00,
+    /*"g",71*/
+    0x00, 0x00, 0x38, 0x48, 0x48, 0x38, 0x08, 0x30,
+    /*"h",72*/
+    0xC0, 0x40, 0x70, 0x48, 0x48, 0xE8, 0x00, 0x00,
+    /*"i",73*/
+    0x20, 0x00, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00,
+    /*"j",74*/
+    0x20, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x70,
+    /*"k",75*/
+    0xC0, 0x40, 0x58, 0x70, 0x50, 0xD8, 0x00, 0x00,
+    /*"l",76*/
+    0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    /*"m",77*/
+    0x00, 0x00, 0xD0, 0xA8, 0xA8, 0xA8, 0x00, 0x00,
+    /*"n",78*/
+    0x00, 0x00, 0xF0, 0x48, 0x48, 0xC8, 0x00, 0x00,
+    /*"o",79*/
+    0x00, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00,
+    /*"p",80*/
+    0x00, 0x00, 0xF0, 0x48, 0x48, 0x70, 0x40, 0xE0,
+    /*"q",81*/
+    0x00, 0x00, 0x38, 0x48, 0x48, 0x38, 0x08, 0x18,
+    /*"r",82*/
+    0x00, 0x00, 0x78, 0x20, 0x20, 0x70, 0x00, 0x00,
+    /*"s",83*/
+    0x00, 0x00, 0x30, 0x20, 0x10, 0x60, 0x00, 0x00,
+    /*"t",84*/
+    0x00, 0x40, 0xF0, 0x40, 0x48, 0x30, 0x00, 0x00,
+    /*"u",85*/
+    0x00, 0x00, 0xD8, 0x48, 0x48, 0x38, 0x00, 0x00,
+    /*"v",86*/
+    0x00, 0x00, 0xC8, 0x48, 0x30, 0x30, 0x00, 0x00,
+    /*"w",87*/
+    0x00, 0x00, 0xD8, 0xA8, 0xA8, 0x50, 0x00, 0x00,
+    /*"x",88*/
+    0x00, 0x00, 0x48, 0x30, 0x30, 0x48, 0x00, 0x00,
+    /*"y",89*/
+    0x00, 0x00, 0xD8, 0x50, 0x50, 0x20, 0x20, 0x60,
+    /*"z",90*/
+    0x00, 0x00, 0x78, 0x50, 0x28, 0x78, 0x00, 0x00,
+    /*"{",91*/
+    0x10, 0x20, 0x20, 0x60, 0x20, 0x20, 0x10, 0x00,
+    /*"|",92*/
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    /*"}",93*/
+    0x40, 0x20, 0x20, 0x30, 0x20, 0x20, 0x40, 0x00,
+    /*"~",94*/
+    0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00,
+};
+
+const uint8 FONT_EN_7X12_ROWS[] =
+{
+    0x00,
+    0x10,
+    0x6C,
+    0x48,
+    0x14,
+    0x28,
+    0x7C,
+    0x50,
+    0x38,
+    0x40,
+    0x70,
+    0x20,
+    0x0C,
+    0x08,
+    0x18,
+    0x54,
+    0x34,
+    0xFE,
+    0x30,
+    0x04,
+    0x44,
+    0x24,
+    0x7E,
+    0x0E,
+    0x3C,
+    0x1C,
+    0x78,
+    0x60,
+    0x80,
+    0xC0,
+    0x4C,
+    0xEE,
+    0xF8,
+    0xF0,
+    0xFC,
+    0x22,
+    0x4E,
+    0xE6,
+    0x64,
+    0xEC,
+    0xE2,
+    0x58,
+    0x92,
+    0xC6,
+    0x3E,
+    0x36,
+    0x5C,
+    0xDC,
+    0xE8,
+    0xD8,
+    0xE0,
+    0xCC,
+};
+
+const uint8 FONT_EN_7X12_GLYPH[] =
+{
+    /*" ",0*/
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"!",1*/
+    0x01, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01,
+    /*""",2*/
+    0x01, 0x03, 0x02, 0x03, 0x03,
+    /*"#",3*/
+    0x01, 0x09, 0x04, 0x04, 0x05, 0x06, 0x05, 0x06, 0x05, 0x07, 0x07,
+    /*"$",4*/
+    0x01, 0x09, 0x01, 0x08, 0x09, 0x09, 0x08, 0x03, 0x0A, 0x01, 0x01,
+    /*"%",5*/
+    0x01, 0x08, 0x0B, 0x07, 0x0B, 0x0C, 0x0A, 0x0D, 0x04, 0x0D,
+    /*"&",6*/
+    0x03, 0x06, 0x0E, 0x0B, 0x0B, 0x0F, 0x03, 0x10,
+    /*"'",7*/
+    0x01, 0x04, 0x01, 0x01, 0x01, 0x01,
+    /*"(",8*/
+    0x01, 0x0A, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0D,
+    /*")",9*/
+    0x01, 0x0A, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B,
+    /*"*",10*/
+    0x01, 0x05, 0x01, 0x06, 0x01, 0x05, 0x05,
+    /*"+",11*/
+    0x02, 0x07, 0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01,
+    /*",",12*/
+    0x07, 0x04, 0x0E, 0x01, 0x12, 0x0B,
+    /*"-",13*/
+    0x05, 0x01, 0x06,
+    /*".",14*/
+    0x07, 0x02, 0x12, 0x12,
+    /*"/",15*/
+    0x01, 0x09, 0x13, 0x13, 0x0D, 0x0D, 0x01, 0x01, 0x0B, 0x0B, 0x09,
+    /*"0",16*/
+    0x01, 0x08, 0x08, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x08,
+    /*"1",17*/
+    0x01, 0x08, 0x12, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06,
+    /*"2",18*/
+    0x01, 0x08, 0x08, 0x14, 0x13, 0x0D, 0x01, 0x0B, 0x14, 0x06,
+    /*"3",19*/
+    0x01, 0x08, 0x08, 0x14, 0x13, 0x0E, 0x13, 0x13, 0x14, 0x08,
+    /*"4",20*/
+    0x01, 0x08, 0x0C, 0x04, 0x04, 0x15, 0x14, 0x16, 0x13, 0x17,
+    /*"5",21*/
+    0x01, 0x08, 0x18, 0x0B, 0x0B, 0x08, 0x13, 0x13, 0x14, 0x08,
+    /*"6",22*/
+    0x01, 0x08, 0x19, 0x0B, 0x09, 0x1A, 0x14, 0x14, 0x14, 0x08,
+    /*"7",23*/
+    0x01, 0x08, 0x06, 0x14, 0x13, 0x0D, 0x0D, 0x0D, 0x01, 0x01,
+    /*"8",24*/
+    0x01, 0x08, 0x08, 0x14, 0x14, 0x08, 0x14, 0x14, 0x14, 0x08,
+    /*"9",25*/
+    0x01, 0x08, 0x08, 0x14, 0x14, 0x14, 0x18, 0x13, 0x0D, 0x0A,
+    /*":",26*/
+    0x03, 0x06, 0x12, 0x12, 0x00, 0x00, 0x12, 0x12,
+    /*";",27*/
+    0x03, 0x07, 0x0E, 0x0E, 0x00, 0x00, 0x0E, 0x12, 0x0B,
+    /*"<",28*/
+    0x02, 0x07, 0x0C, 0x01, 0x1B, 0x1C, 0x1B, 0x01, 0x0C,
+    /*"=",29*/
+    0x04, 0x03, 0x06, 0x00, 0x06,
+    /*">",30*/
+    0x02, 0x07, 0x1D, 0x0B, 0x0E, 0x13, 0x0E, 0x0B, 0x1D,
+    /*"?",31*/
+    0x02, 0x07, 0x0E, 0x15, 0x13, 0x0D, 0x01, 0x00, 0x12,
+    /*"@",32*/
+    0x00, 0x0A, 0x08, 0x14, 0x14, 0x1E, 0x0F, 0x0F, 0x1E, 0x09, 0x14, 0x08,
+    /*"A",33*/
+    0x01, 0x08, 0x12, 0x01, 0x05, 0x05, 0x05, 0x06, 0x14, 0x1F,
+    /*"B",34*/
+    0x01, 0x08, 0x20, 0x14, 0x14, 0x1A, 0x14, 0x14, 0x14, 0x20,
+    /*"C",35*/
+    0x01, 0x08, 0x18, 0x14, 0x09, 0x09, 0x09, 0x09, 0x14, 0x08,
+    /*"D",36*/
+    0x01, 0x08, 0x21, 0x03, 0x14, 0x14, 0x14, 0x14, 0x03, 0x21,
+    /*"E",37*/
+    0x01, 0x08, 0x22, 0x14, 0x07, 0x0A, 0x07, 0x09, 0x14, 0x22,
+    /*"F",38*/
+    0x01, 0x08, 0x16, 0x23, 0x05, 0x08, 0x05, 0x0B, 0x0B, 0x0A,
+    /*"G",39*/
+    0x01, 0x08, 0x18, 0x14, 0x09, 0x09, 0x24, 0x14, 0x14, 0x08,
+    /*"H",40*/
+    0x01, 0x08, 0x1F, 0x14, 0x14, 0x06, 0x14, 0x14, 0x14, 0x1F,
+    /*"I",41*/
+    0x01, 0x08, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06,
+    /*"J",42*/
+    0x01, 0x08, 0x18, 0x0D, 0x0D, 0x0D, 0x03, 0x03, 0x03, 0x12,
+    /*"K",43*/
+    0x01, 0x08, 0x1F, 0x14, 0x03, 0x07, 0x0A, 0x03, 0x14, 0x25,
+    /*"L",44*/
+    0x01, 0x08, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x15, 0x15, 0x06,
+    /*"M",45*/
+    0x01, 0x08, 0x1F, 0x02, 0x02, 0x0F, 0x0F, 0x14, 0x14, 0x1F,
+    /*"N",46*/
+    0x01, 0x08, 0x1F, 0x26, 0x26, 0x0F, 0x0F, 0x0F, 0x1E, 0x27,
+    /*"P",48*/
+    0x01, 0x08, 0x1A, 0x15, 0x15, 0x15, 0x08, 0x0B, 0x0B, 0x0A,
+    /*"Q",49*/
+    0x01, 0x09, 0x08, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x08, 0x19,
+    /*"R",50*/
+    0x01, 0x08, 0x20, 0x14, 0x14, 0x14, 0x1A, 0x03, 0x14, 0x28,
+    /*"S",51*/
+    0x01, 0x08, 0x10, 0x1E, 0x09, 0x08, 0x13, 0x13, 0x26, 0x29,
+    /*"T",52*/
+    0x01, 0x08, 0x11, 0x2A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08,
+    /*"U",53*/
+    0x01, 0x08, 0x1F, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x08,
+    /*"V",54*/
+    0x01, 0x08, 0x1F, 0x14, 0x14, 0x05, 0x05, 0x05, 0x01, 0x01,
+    /*"W",55*/
+    0x01, 0x08, 0x1F, 0x14, 0x14, 0x0F, 0x0F, 0x0F, 0x0F, 0x05,
+    /*"X",56*/
+    0x01, 0x08, 0x2B, 0x14, 0x05, 0x01, 0x01, 0x05, 0x14, 0x2B,
+    /*"Y",57*/
+    0x01, 0x08, 0x1F, 0x14, 0x05, 0x05, 0x01, 0x01, 0x01, 0x08,
+    /*"Z",58*/
+    0x01, 0x08, 0x06, 0x14, 0x0D, 0x01, 0x01, 0x0B, 0x14, 0x06,
+    /*"[",59*/
+    0x01, 0x0A, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08,
+    /*"\",60*/
+    0x01, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x0D, 0x0D, 0x0D,
+    /*"]",61*/
+    0x01, 0x0A, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x08,
+    /*"^",62*/
+    0x01, 0x04, 0x01, 0x01, 0x05, 0x14,
+    /*"_",63*/
+    0x0B, 0x01, 0x11,
+    /*"`",64*/
+    0x01, 0x02, 0x01, 0x0D,
+    /*"a",65*/
+    0x03, 0x06, 0x08, 0x14, 0x18, 0x14, 0x14, 0x2C,
+    /*"b",66*/
+    0x01, 0x08, 0x1D, 0x09, 0x29, 0x26, 0x14, 0x14, 0x14, 0x20,
+    /*"c",67*/
+    0x03, 0x06, 0x18, 0x14, 0x09, 0x09, 0x14, 0x08,
+    /*"d",68*/
+    0x01, 0x08, 0x0C, 0x13, 0x10, 0x1E, 0x14, 0x14, 0x14, 0x2C,
+    /*"e",69*/
+    0x03, 0x06, 0x08, 0x14, 0x06, 0x09, 0x09, 0x18,
+    /*"f",70*/
+    0x01, 0x08, 0x19, 0x0B, 0x06, 0x0B, 0x0B, 0x0B, 0x0B, 0x06,
+    /*"g",71*/
+    0x03, 0x08, 0x2D, 0x1E, 0x14, 0x14, 0x14, 0x18, 0x13, 0x08,
+    /*"h",72*/
+    0x01, 0x08, 0x1D, 0x09, 0x29, 0x26, 0x14, 0x14, 0x14, 0x1F,
+    /*"i",73*/
+    0x01, 0x08, 0x01, 0x00, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x06,
+    /*"j",74*/
+    0x01, 0x0A, 0x01, 0x00, 0x1A, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0A,
+    /*"k",75*/
+    0x01, 0x08, 0x1D, 0x09, 0x2E, 0x03, 0x0A, 0x07, 0x03, 0x2F,
+    /*"m",77*/
+    0x03, 0x06, 0x30, 0x0F, 0x0F, 0x0F, 0x0F, 0x11,
+    /*"n",78*/
+    0x03, 0x06, 0x31, 0x26, 0x14, 0x14, 0x14, 0x1F,
+    /*"o",79*/
+    0x03, 0x06, 0x08, 0x14, 0x14, 0x14, 0x14, 0x08,
+    /*"p",80*/
+    0x03, 0x08, 0x31, 0x26, 0x14, 0x14, 0x14, 0x1A, 0x09, 0x32,
+    /*"q",81*/
+    0x03, 0x08, 0x2D, 0x1E, 0x14, 0x14, 0x14, 0x18, 0x13, 0x17,
+    /*"r",82*/
+    0x03, 0x06, 0x02, 0x12, 0x0B, 0x0B, 0x0B, 0x06,
+    /*"s",83*/
+    0x03, 0x06, 0x18, 0x14, 0x08, 0x13, 0x14, 0x1A,
+    /*"t",84*/
+    0x02, 0x07, 0x0B, 0x06, 0x0B, 0x0B, 0x0B, 0x23, 0x19,
+    /*"u",85*/
+    0x03, 0x06, 0x33, 0x14, 0x14, 0x14, 0x1E, 0x2D,
+    /*"v",86*/
+    0x03, 0x06, 0x1F, 0x14, 0x14, 0x05, 0x05, 0x01,
+    /*"w",87*/
+    0x03, 0x06, 0x1F, 0x14, 0x0F, 0x0F, 0x0F, 0x05,
+    /*"x",88*/
+    0x03, 0x06, 0x33, 0x03, 0x12, 0x12, 0x03, 0x33,
+    /*"y",89*/
+    0x03, 0x08, 0x1F, 0x14, 0x15, 0x05, 0x0E, 0x01, 0x01, 0x1A,
+    /*"z",90*/
+    0x03, 0x06, 0x06, 0x03, 0x01, 0x0B, 0x14, 0x06,
+    /*"{",91*/
+    0x01, 0x0A, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x01, 0x01, 0x01, 0x0D,
+    /*"|",92*/
+    0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    /*"}",93*/
+    0x01, 0x0A, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x01, 0x01, 0x01, 0x0B,
+    /*"~",94*/
+    0x05, 0x02, 0x15, 0x29,
+};
+
+const uint16 FONT_EN_7X12_OFFSET[] =
+{
+    0, 14, 24, 29, 40, 51, 61, 69, 75, 87, 99, 106, 115, 121, 124, 128,
+    139, 149, 159, 169, 179, 189, 199, 209, 219, 229, 239, 247, 256, 265, 270, 279,
+    288, 300, 310, 320, 330, 340, 350, 360, 370, 380, 390, 400, 410, 420, 430, 139,
+    440, 450, 461, 471, 481, 491, 501, 511, 521, 531, 541, 551, 563, 574, 586, 592,
+    595, 599, 607, 617, 625, 635, 643, 653, 663, 673, 683, 695, 149, 705, 713, 721,
+    729, 739, 749, 757, 765, 774, 782, 790, 798, 806, 816, 824, 836, 847, 859,
+};
+
+const uint8 FONT_EN_8X16_ROWS[] =
+{
+    0x00,
+    0x10,
+    0x18,
+    0x60,
+    0x20,
+    0xC0,
+    0x24,
+    0xFE,
+    0x48,
+    0x38,
+    0x54,
+    0x50,
+    0x30,
+    0x14,
+    0x44,
+    0xA4,
+    0xA8,
+    0x1A,
+    0x2A,
+    0x6E,
+    0x94,
+    0x88,
+    0x89,
+    0x76,
+    0x02,
+    0x04,
+    0x08,
+    0x40,
+    0xD6,
+    0x7F,
+    0x01,
+    0x42,
+    0x70,
+    0x7C,
+    0x3C,
+    0x7E,
+    0x0C,
+    0x1E,
+    0x58,
+    0x64,
+    0x1C,
+    0x26,
+    0x62,
+    0x5A,
+    0xAA,
+    0xB4,
+    0x28,
+    0xE7,
+    0xF8,
+    0x78,
+    0x3E,
+    0x80,
+    0xFC,
+    0xE0,
+    0x8E,
+    0x84,
+    0xF0,
+    0xEE,
+    0x6C,
+    0xC7,
+    0x52,
+    0x4A,
+    0x46,
+    0xE2,
+    0x82,
+    0xB2,
+    0xCA,
+    0x4C,
+    0x06,
+    0xE3,
+    0x92,
+    0x22,
+    0xFF,
+    0x3F,
+    0x1B,
+    0x0F,
+    0x11,
+    0x5C,
+    0x4E,
+    0x68,
+    0x49,
+    0xED,
+    0xDC,
+    0xD8,
+    0x07,
+    0x32,
+    0xC6,
+    0x3B,
+    0xD7,
+    0x03,
+    0x43,
+};
+
+const uint8 FONT_EN_8X16_GLYPH[] =
+{
+    /*" ",0*/
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+    /*"!",1*/
+    0x03, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02,
+    /*""",2*/
+    0x01, 0x04, 0x03, 0x03, 0x04, 0x05,
+    /*"#",3*/
+    0x03, 0x0B, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x08,
+    /*"$",4*/
+    0x02, 0x0E, 0x01, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x02, 0x0D, 0x0D, 0x0A, 0x0A, 0x09, 0x01, 0x01,
+    /*"%",5*/
+    0x03, 0x0B, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x0A, 0x11, 0x12, 0x12, 0x12, 0x0E,
+    /*"&",6*/
+    0x03, 0x0B, 0x0C, 0x08, 0x08, 0x08, 0x0B, 0x13, 0x0F, 0x14, 0x15, 0x16, 0x17,
+    /*"(",8*/
+    0x01, 0x0E, 0x18, 0x19, 0x1A, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1A, 0x1A, 0x19, 0x18,
+    /*")",9*/
+    0x01, 0x0E, 0x1B, 0x04, 0x01, 0x01, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x01, 0x01, 0x04, 0x1B,
+    /*"*",10*/
+    0x04, 0x08, 0x01, 0x01, 0x1C, 0x09, 0x09, 0x1C, 0x01, 0x01,
+    /*"+",11*/
+    0x04, 0x09, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x01,
+    /*",",12*/
+    0x0C, 0x04, 0x03, 0x03, 0x04, 0x05,
+    /*"-",13*/
+    0x08, 0x01, 0x1D,
+    /*".",14*/
+    0x0C, 0x02, 0x03, 0x03,
+    /*"/",15*/
+    0x02, 0x0D, 0x1E, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x01, 0x01, 0x04, 0x04, 0x1B, 0x1B,
+    /*"0",16*/
+    0x03, 0x0B, 0x02, 0x06, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x06, 0x02,
+    /*"1",17*/
+    0x03, 0x0B, 0x01, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21,
+    /*"2",18*/
+    0x03, 0x0B, 0x22, 0x1F, 0x1F, 0x1F, 0x19, 0x19, 0x1A, 0x01, 0x04, 0x1F, 0x23,
+    /*"3",19*/
+    0x03, 0x0B, 0x22, 0x1F, 0x1F, 0x19, 0x02, 0x19, 0x18, 0x18, 0x1F, 0x0E, 0x09,
+    /*"4",20*/
+    0x03, 0x0B, 0x19, 0x24, 0x0D, 0x06, 0x06, 0x0E, 0x0E, 0x23, 0x19, 0x19, 0x25,
+    /*"5",21*/
+    0x03, 0x0B, 0x23, 0x1B, 0x1B, 0x1B, 0x26, 0x27, 0x18, 0x18, 0x1F, 0x0E, 0x09,
+    /*"6",22*/
+    0x03, 0x0B, 0x28, 0x06, 0x1B, 0x1B, 0x26, 0x27, 0x1F, 0x1F, 0x1F, 0x06, 0x02,
+    /*"7",23*/
+    0x03, 0x0B, 0x23, 0x0E, 0x0E, 0x1A, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    /*"8",24*/
+    0x03, 0x0B, 0x22, 0x1F, 0x1F, 0x1F, 0x06, 0x02, 0x06, 0x1F, 0x1F, 0x1F, 0x22,
+    /*"9",25*/
+    0x03, 0x0B, 0x02, 0x06, 0x1F, 0x1F, 0x1F, 0x29, 0x11, 0x18, 0x18, 0x06, 0x09,
+    /*":",26*/
+    0x06, 0x08, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
+    /*";",27*/
+    0x07, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04,
+    /*"<",28*/
+    0x03, 0x0B, 0x18, 0x19, 0x1A, 0x01, 0x04, 0x1B, 0x04, 0x01, 0x1A, 0x19, 0x18,
+    /*"=",29*/
+    0x06, 0x05, 0x07, 0x00, 0x00, 0x00, 0x07,
+    /*">",30*/
+    0x03, 0x0B, 0x1B, 0x04, 0x01, 0x1A, 0x19, 0x18, 0x19, 0x1A, 0x01, 0x04, 0x1B,
+    /*"?",31*/
+    0x03, 0x0B, 0x22, 0x1F, 0x1F, 0x2A, 0x18, 0x19, 0x1A, 0x1A, 0x00, 0x02, 0x02,
+    /*"@",32*/
+    0x03, 0x0B, 0x09, 0x0E, 0x2B, 0x2C, 0x2C, 0x2C, 0x2C, 0x2D, 0x1F, 0x0E, 0x09,
+    /*"A",33*/
+    0x03, 0x0B, 0x01, 0x01, 0x02, 0x2E, 0x2E, 0x06, 0x22, 0x0E, 0x1F, 0x1F, 0x2F,
+    /*"B",34*/
+    0x03, 0x0B, 0x30, 0x0E, 0x0E, 0x0E, 0x31, 0x0E, 0x1F, 0x1F, 0x1F, 0x0E, 0x30,
+    /*"C",35*/
+    0x03, 0x0B, 0x32, 0x1F, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1F, 0x0E, 0x09,
+    /*"D",36*/
+    0x03, 0x0B, 0x30, 0x0E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0E, 0x30,
+    /*"E",37*/
+    0x03, 0x0B, 0x34, 0x1F, 0x08, 0x08, 0x31, 0x08, 0x08, 0x1B, 0x1F, 0x1F, 0x34,
+    /*"F",38*/
+    0x03, 0x0B, 0x34, 0x1F, 0x08, 0x08, 0x31, 0x08, 0x08, 0x1B, 0x1B, 0x1B, 0x35,
+    /*"G",39*/
+    0x03, 0x0B, 0x22, 0x0E, 0x0E, 0x33, 0x33, 0x33, 0x36, 0x37, 0x0E, 0x0E, 0x09,
+    /*"H",40*/
+    0x03, 0x0B, 0x2F, 0x1F, 0x1F, 0x1F, 0x1F, 0x23, 0x1F, 0x1F, 0x1F, 0x1F, 0x2F,
+    /*"I",41*/
+    0x03, 0x0B, 0x21, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21,
+    /*"J",42*/
+    0x03, 0x0D, 0x32, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x15, 0x38,
+    /*"K",43*/
+    0x03, 0x0B, 0x39, 0x0E, 0x08, 0x0B, 0x20, 0x0B, 0x08, 0x08, 0x0E, 0x0E, 0x39,
+    /*"L",44*/
+    0x03, 0x0B, 0x35, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1F, 0x07,
+    /*"M",45*/
+    0x03, 0x0B, 0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x1C,
+    /*"N",46*/
+    0x03, 0x0B, 0x3B, 0x2A, 0x2A, 0x3C, 0x3C, 0x3D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F,
+    /*"O",47*/
+    0x03, 0x0B, 0x09, 0x0E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x0E, 0x09,
+    /*"P",48*/
+    0x03, 0x0B, 0x34, 0x1F, 0x1F, 0x1F, 0x1F, 0x21, 0x1B, 0x1B, 0x1B, 0x1B, 0x35,
+    /*"Q",49*/
+    0x03, 0x0C, 0x09, 0x0E, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x42, 0x43, 0x09, 0x44,
+    /*"R",50*/
+    0x03, 0x0B, 0x34, 0x1F, 0x1F, 0x1F, 0x21, 0x08, 0x08, 0x0E, 0x0E, 0x1F, 0x45,
+    /*"S",51*/
+    0x03, 0x0B, 0x32, 0x1F, 0x1F, 0x1B, 0x04, 0x02, 0x19, 0x18, 0x1F, 0x1F, 0x21,
+    /*"T",52*/
+    0x03, 0x0B, 0x07, 0x46, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09,
+    /*"U",53*/
+    0x03, 0x0B, 0x2F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x22,
+    /*"V",54*/
+    0x03, 0x0B, 0x2F, 0x1F, 0x1F, 0x0E, 0x06, 0x06, 0x2E, 0x2E, 0x02, 0x01, 0x01,
+    /*"W",55*/
+    0x03, 0x0B, 0x1C, 0x46, 0x46, 0x46, 0x46, 0x2C, 0x2C, 0x3A, 0x0E, 0x0E, 0x0E,
+    /*"X",56*/
+    0x03, 0x0B, 0x2F, 0x1F, 0x06, 0x06, 0x02, 0x02, 0x02, 0x06, 0x06, 0x1F, 0x2F,
+    /*"Y",57*/
+    0x03, 0x0B, 0x39, 0x0E, 0x0E, 0x2E, 0x2E, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09,
+    /*"Z",58*/
+    0x03, 0x0B, 0x23, 0x37, 0x19, 0x1A, 0x1A, 0x01, 0x04, 0x04, 0x1F, 0x1F, 0x34,
+    /*"[",59*/
+    0x01, 0x0E, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25,
+    /*"\",60*/
+    0x02, 0x0E, 0x1B, 0x1B, 0x04, 0x04, 0x01, 0x01, 0x01, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x18,
+    /*"]",61*/
+    0x01, 0x0E, 0x31, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x31,
+    /*"^",62*/
+    0x01, 0x02, 0x28, 0x47,
+    /*"_",63*/
+    0x0F, 0x01, 0x48,
+    /*"a",65*/
+    0x07, 0x07, 0x22, 0x1F, 0x25, 0x47, 0x1F, 0x1F, 0x49,
+    /*"b",66*/
+    0x03, 0x0B, 0x05, 0x1B, 0x1B, 0x1B, 0x26, 0x27, 0x1F, 0x1F, 0x1F, 0x27, 0x26,
+    /*"c",67*/
+    0x07, 0x07, 0x28, 0x47, 0x1B, 0x1B, 0x1B, 0x47, 0x28,
+    /*"d",68*/
+    0x03, 0x0B, 0x44, 0x18, 0x18, 0x18, 0x25, 0x47, 0x1F, 0x1F, 0x1F, 0x29, 0x4A,
+    /*"e",69*/
+    0x07, 0x07, 0x22, 0x1F, 0x23, 0x1B, 0x1B, 0x1F, 0x22,
+    /*"f",70*/
+    0x03, 0x0B, 0x4B, 0x4C, 0x01, 0x01, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21,
+    /*"g",71*/
+    0x07, 0x09, 0x32, 0x0E, 0x0E, 0x09, 0x1B, 0x22, 0x1F, 0x1F, 0x22,
+    /*"h",72*/
+    0x03, 0x0B, 0x05, 0x1B, 0x1B, 0x1B, 0x4D, 0x2A, 0x1F, 0x1F, 0x1F, 0x1F, 0x2F,
+    /*"i",73*/
+    0x03, 0x0B, 0x0C, 0x0C, 0x00, 0x00, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21,
+    /*"k",75*/
+    0x03, 0x0B, 0x05, 0x1B, 0x1B, 0x1B, 0x4E, 0x08, 0x0B, 0x4F, 0x08, 0x0E, 0x39,
+    /*"l",76*/
+    0x03, 0x0B, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21,
+    /*"m",77*/
+    0x07, 0x07, 0x07, 0x50, 0x50, 0x50, 0x50, 0x50, 0x51,
+    /*"n",78*/
+    0x07, 0x07, 0x52, 0x2A, 0x1F, 0x1F, 0x1F, 0x1F, 0x2F,
+    /*"o",79*/
+    0x07, 0x07, 0x22, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x22,
+    /*"p",80*/
+    0x07, 0x09, 0x53, 0x27, 0x1F, 0x1F, 0x1F, 0x0E, 0x31, 0x1B, 0x35,
+    /*"q",81*/
+    0x07, 0x09, 0x25, 0x47, 0x1F, 0x1F, 0x1F, 0x47, 0x25, 0x18, 0x54,
+    /*"r",82*/
+    0x07, 0x07, 0x39, 0x55, 0x04, 0x04, 0x04, 0x04, 0x30,
+    /*"s",83*/
+    0x07, 0x07, 0x32, 0x1F, 0x1B, 0x22, 0x18, 0x1F, 0x21,
+    /*"t",84*/
+    0x05, 0x09, 0x01, 0x01, 0x21, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24,
+    /*"u",85*/
+    0x07, 0x07, 0x56, 0x1F, 0x1F, 0x1F, 0x1F, 0x3E, 0x57,
+    /*"v",86*/
+    0x07, 0x07, 0x2F, 0x1F, 0x06, 0x06, 0x2E, 0x01, 0x01,
+    /*"w",87*/
+    0x07, 0x07, 0x58, 0x46, 0x46, 0x2C, 0x2C, 0x0E, 0x0E,
+    /*"x",88*/
+    0x07, 0x07, 0x13, 0x06, 0x02, 0x02, 0x02, 0x06, 0x17,
+    /*"y",89*/
+    0x07, 0x09, 0x2F, 0x1F, 0x06, 0x06, 0x2E, 0x02, 0x01, 0x01, 0x35,
+    /*"z",90*/
+    0x07, 0x07, 0x23, 0x0E, 0x1A, 0x01, 0x01, 0x47, 0x23,
+    /*"{",91*/
+    0x01, 0x0E, 0x59, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x59,
+    /*"|",92*/
+    0x00, 0x10, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A,
+    /*"}",93*/
+    0x01, 0x0E, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
+    /*"~",94*/
+    0x00, 0x03, 0x0C, 0x43, 0x5A,
+};
+
+const uint16 FONT_EN_8X16_OFFSET[] =
+{
+    0, 18, 31, 37, 50, 66, 79, 31, 92, 108, 124, 134, 145, 151, 154, 158,
+    173, 186, 199, 212, 225, 238, 251, 264, 277, 290, 303, 313, 324, 337, 344, 357,
+    370, 383, 396, 409, 422, 435, 448, 461, 474, 487, 500, 515, 528, 541, 554, 567,
+    580, 593, 607, 620, 633, 646, 659, 672, 685, 698, 711, 724, 740, 756, 772, 776,
+    31, 779, 788, 801, 810, 823, 832, 845, 856, 869, 845, 882, 895, 908, 917, 926,
+    935, 946, 957, 966, 975, 986, 995, 1004, 1013, 1022, 1033, 1042, 1058, 1076, 1092,
+};
+
+const uint8 FONT_EN_11X16_ROWS[] =
+{
+    0x00, 0x00,
+    0x0C, 0x00,
+    0x1D, 0xC0,
+    0x08, 0x80,
+    0x0D, 0x80,
+    0x3F, 0xC0,
+    0x1B, 0x00,
+    0x04, 0x00,
+    0x1F, 0x80,
+    0x31, 0x80,
+    0x38, 0x00,
+    0x1E, 0x00,
+    0x0F, 0x00,
+    0x03, 0x80,
+    0x3F, 0x00,
+    0x18, 0x00,
+    0x24, 0x00,
+    0x18, 0xC0,
+    0x07, 0x80,
+    0x02, 0x40,
+    0x01, 0x80,
+    0x1D, 0x80,
+    0x37, 0x00,
+    0x33, 0x00,
+    0x07, 0x00,
+    0x02, 0x00,
+    0x03, 0x00,
+    0x06, 0x00,
+    0x0E, 0x00,
+    0x1C, 0x00,
+    0x19, 0x80,
+    0x3F, 0x80,
+    0x08, 0x00,
+    0x00, 0xC0,
+    0x30, 0x00,
+    0x3E, 0x00,
+    0x61, 0x80,
+    0x1F, 0x00,
+    0x0B, 0x00,
+    0x13, 0x00,
+    0x0F, 0x80,
+    0x11, 0x80,
+    0x21, 0x80,
+    0x39, 0x80,
+    0x7F, 0x00,
+    0x43, 0x00,
+    0x33, 0x80,
+    0x3C, 0x00,
+    0x60, 0x00,
+    0x7F, 0xC0,
+    0x11, 0x00,
+    0x21, 0x00,
+    0x27, 0x00,
+    0x29, 0x00,
+    0x20, 0x00,
+    0x09, 0x00,
+    0x30, 0xC0,
+    0x79, 0xE0,
+    0x1F, 0x40,
+    0x60, 0x40,
+    0x30, 0x80,
+    0x7F, 0x80,
+    0x32, 0x00,
+    0x30, 0x40,
+    0x7C, 0x00,
+    0x1E, 0x80,
+    0x60, 0x80,
+    0x67, 0xC0,
+    0x7B, 0xC0,
+    0x1F, 0xC0,
+    0x63, 0x00,
+    0x36, 0x00,
+    0x79, 0xC0,
+    0x7E, 0x00,
+    0x18, 0x40,
+    0xE0, 0xE0,
+    0x60, 0xC0,
+    0x71, 0xC0,
+    0x6A, 0xC0,
+    0x6E, 0xC0,
+    0x64, 0xC0,
+    0xFB, 0xE0,
+    0x73, 0xC0,
+    0x3D, 0x80,
+    0x35, 0x80,
+    0x37, 0x80,
+    0x79, 0x80,
+    0x0C, 0xC0,
+    0x7C, 0xE0,
+    0x4C, 0x80,
+    0x0A, 0x00,
+    0x2A, 0x80,
+    0x3B, 0x80,
+    0x23, 0x00,
+    0x18, 0x80,
+    0x20, 0x80,
+    0xFF, 0xE0,
+    0x70, 0x00,
+    0x77, 0x00,
+    0x07, 0xE0,
+    0x77, 0xC0,
+    0x36, 0xC0,
+    0x76, 0xE0,
+    0x07, 0xC0,
+    0x7B, 0x80,
+    0x1C, 0xC0,
+    0x73, 0x80,
+    0xF1, 0xE0,
+    0x24, 0x80,
+};
+
+const uint8 FONT_EN_11X16_GLYPH[] =
+{
+    /*" ",0*/
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+    /*"!",1*/
+    0x01, 0x0A, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+    /*""",2*/
+    0x02, 0x05, 0x02, 0x02, 0x03, 0x03, 0x03,
+    /*"#",3*/
+    0x01, 0x0B, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x05, 0x06, 0x06, 0x06, 0x06,
+    /*"$",4*/
+    0x00, 0x0D, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x09, 0x09, 0x0E, 0x07, 0x07,
+    /*"%",5*/
+    0x01, 0x0A, 0x0F, 0x10, 0x10, 0x11, 0x12, 0x0B, 0x09, 0x13, 0x13, 0x14,
+    /*"&",6*/
+    0x02, 0x09, 0x0C, 0x0F, 0x0F, 0x0F, 0x01, 0x15, 0x16, 0x17, 0x15,
+    /*"'",7*/
+    0x02, 0x05, 0x18, 0x18, 0x19, 0x19, 0x19,
+    /*"(",8*/
+    0x01, 0x0C, 0x1A, 0x1A, 0x1B, 0x1C, 0x01, 0x01, 0x01, 0x01, 0x1C, 0x1B, 0x1A, 0x1A,
+    /*")",9*/
+    0x01, 0x0C, 0x0F, 0x0F, 0x01, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x01, 0x1D, 0x0F,
+    /*"*",10*/
+    0x01, 0x07, 0x1B, 0x1B, 0x05, 0x05, 0x0C, 0x08, 0x1E,
+    /*"+",11*/
+    0x03, 0x07, 0x07, 0x07, 0x07, 0x1F, 0x07, 0x07, 0x07,
+    /*",",12*/
+    0x09, 0x05, 0x1B, 0x07, 0x01, 0x20, 0x20,
+    /*"-",13*/
+    0x06, 0x01, 0x1F,
+    /*".",14*/
+    0x09, 0x02, 0x01, 0x01,
+    /*"/",15*/
+    0x00, 0x0D, 0x21, 0x21, 0x14, 0x14, 0x1A, 0x1A, 0x1B, 0x01, 0x01, 0x0F, 0x0F, 0x22, 0x22,
+    /*"0",16*/
+    0x01, 0x0A, 0x1C, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x1C,
+    /*"1",17*/
+    0x01, 0x0A, 0x1B, 0x23, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x05,
+    /*"2",18*/
+    0x01, 0x0A, 0x0C, 0x1E, 0x09, 0x09, 0x1A, 0x1B, 0x01, 0x0F, 0x22, 0x1F,
+    /*"3",19*/
+    0x01, 0x0A, 0x0E, 0x24, 0x14, 0x1A, 0x25, 0x0D, 0x14, 0x14, 0x24, 0x0E,
+    /*"4",20*/
+    0x01, 0x0A, 0x18, 0x18, 0x0C, 0x26, 0x06, 0x27, 0x17, 0x1F, 0x1A, 0x28,
+    /*"5",21*/
+    0x01, 0x0A, 0x08, 0x0F, 0x0F, 0x0F, 0x25, 0x29, 0x14, 0x14, 0x2A, 0x25,
+    /*"6",22*/
+    0x01, 0x0A, 0x12, 0x1D, 0x0F, 0x22, 0x16, 0x2B, 0x09, 0x09, 0x1E, 0x0C,
+    /*"7",23*/
+    0x01, 0x0A, 0x2C, 0x2D, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x01, 0x01, 0x01,
+    /*"8",24*/
+    0x01, 0x0A, 0x25, 0x09, 0x09, 0x09, 0x25, 0x09, 0x09, 0x09, 0x09, 0x25,
+    /*"9",25*/
+    0x01, 0x0A, 0x0B, 0x17, 0x09, 0x09, 0x2E, 0x15, 0x14, 0x1A, 0x18, 0x2F,
+    /*":",26*/
+    0x04, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+    /*";",27*/
+    0x04, 0x09, 0x1A, 0x1A, 0x00, 0x00, 0x00, 0x1B, 0x07, 0x20, 0x20,
+    /*"<",28*/
+    0x02, 0x09, 0x21, 0x1A, 0x07, 0x0F, 0x30, 0x0F, 0x07, 0x1A, 0x21,
+    /*"=",29*/
+    0x05, 0x03, 0x31, 0x00, 0x31,
+    /*">",30*/
+    0x02, 0x09, 0x30, 0x0F, 0x07, 0x1A, 0x21, 0x1A, 0x07, 0x0F, 0x30,
+    /*"?",31*/
+    0x02, 0x09, 0x25, 0x09, 0x09, 0x14, 0x18, 0x01, 0x01, 0x00, 0x01,
+    /*"@",32*/
+    0x01, 0x0B, 0x1C, 0x32, 0x33, 0x33, 0x34, 0x35, 0x35, 0x34, 0x36, 0x32, 0x1C,
+    /*"A",33*/
+    0x02, 0x09, 0x0E, 0x0C, 0x37, 0x1E, 0x1E, 0x08, 0x38, 0x38, 0x39,
+    /*"B",34*/
+    0x02, 0x09, 0x2C, 0x09, 0x09, 0x09, 0x0E, 0x09, 0x09, 0x09, 0x2C,
+    /*"C",35*/
+    0x02, 0x09, 0x3A, 0x38, 0x3B, 0x30, 0x30, 0x30, 0x3B, 0x3C, 0x25,
+    /*"D",36*/
+    0x02, 0x09, 0x2C, 0x09, 0x38, 0x38, 0x38, 0x38, 0x38, 0x09, 0x2C,
+    /*"E",37*/
+    0x02, 0x09, 0x3D, 0x3C, 0x3C, 0x3E, 0x23, 0x3E, 0x3C, 0x3C, 0x3D,
+    /*"F",38*/
+    0x02, 0x09, 0x31, 0x3F, 0x3F, 0x3E, 0x23, 0x3E, 0x22, 0x22, 0x40,
+    /*"G",39*/
+    0x02, 0x09, 0x41, 0x09, 0x42, 0x30, 0x30, 0x43, 0x24, 0x09, 0x25,
+    /*"H",40*/
+    0x02, 0x09, 0x44, 0x09, 0x09, 0x09, 0x1F, 0x09, 0x09, 0x09, 0x44,
+    /*"I",41*/
+    0x02, 0x09, 0x05, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x05,
+    /*"J",42*/
+    0x02, 0x09, 0x45, 0x1A, 0x1A, 0x1A, 0x1A, 0x46, 0x46, 0x46, 0x23,
+    /*"K",43*/
+    0x02, 0x09, 0x44, 0x09, 0x17, 0x47, 0x2F, 0x23, 0x17, 0x09, 0x48,
+    /*"L",44*/
+    0x02, 0x09, 0x49, 0x0F, 0x0F, 0x0F, 0x0F, 0x4A, 0x4A, 0x4A, 0x31,
+    /*"M",45*/
+    0x02, 0x09, 0x4B, 0x4C, 0x4D, 0x44, 0x4E, 0x4F, 0x50, 0x4C, 0x51,
+    /*"N",46*/
+    0x02, 0x09, 0x52, 0x09, 0x2B, 0x53, 0x54, 0x55, 0x2E, 0x09, 0x56,
+    /*"O",47*/
+    0x02, 0x09, 0x25, 0x09, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x09, 0x25,
+    /*"P",48*/
+    0x02, 0x09, 0x2C, 0x09, 0x09, 0x09, 0x09, 0x0E, 0x22, 0x22, 0x49,
+    /*"Q",49*/
+    0x02, 0x0B, 0x25, 0x09, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x09, 0x25, 0x57, 0x08,
+    /*"R",50*/
+    0x02, 0x09, 0x2C, 0x09, 0x09, 0x09, 0x23, 0x17, 0x09, 0x09, 0x58,
+    /*"S",51*/
+    0x02, 0x09, 0x08, 0x09, 0x09, 0x0A, 0x25, 0x0D, 0x09, 0x09, 0x0E,
+    /*"T",52*/
+    0x02, 0x09, 0x3D, 0x59, 0x59, 0x59, 0x01, 0x01, 0x01, 0x01, 0x0E,
+    /*"U",53*/
+    0x02, 0x09, 0x44, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x25,
+    /*"V",54*/
+    0x02, 0x09, 0x44, 0x09, 0x09, 0x06, 0x06, 0x06, 0x5A, 0x1C, 0x1C,
+    /*"W",55*/
+    0x02, 0x09, 0x51, 0x4C, 0x50, 0x4F, 0x4F, 0x5B, 0x5C, 0x5C, 0x09,
+    /*"X",56*/
+    0x02, 0x09, 0x44, 0x09, 0x06, 0x1C, 0x1C, 0x1C, 0x06, 0x09, 0x44,
+    /*"Y",57*/
+    0x02, 0x09, 0x39, 0x38, 0x1E, 0x0C, 0x1B, 0x1B, 0x1B, 0x1B, 0x08,
+    /*"Z",58*/
+    0x02, 0x09, 0x1F, 0x2A, 0x5D, 0x1B, 0x07, 0x01, 0x5E, 0x3C, 0x1F,
+    /*"[",59*/
+    0x01, 0x0C, 0x12, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x12,
+    /*"\",60*/
+    0x00, 0x0D, 0x22, 0x22, 0x0F, 0x0F, 0x01, 0x01, 0x1B, 0x1A, 0x1A, 0x14, 0x14, 0x21, 0x21,
+    /*"]",61*/
+    0x01, 0x0C, 0x0B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0B,
+    /*"^",62*/
+    0x00, 0x06, 0x07, 0x5A, 0x5A, 0x32, 0x5F, 0x5F,
+    /*"_",63*/
+    0x0F, 0x01, 0x60,
+    /*"`",64*/
+    0x00, 0x03, 0x20, 0x07, 0x19,
+    /*"a",65*/
+    0x04, 0x07, 0x25, 0x14, 0x14, 0x08, 0x09, 0x2E, 0x02,
+    /*"b",66*/
+    0x01, 0x0A, 0x61, 0x22, 0x22, 0x16, 0x2B, 0x38, 0x38, 0x38, 0x2B, 0x62,
+    /*"c",67*/
+    0x04, 0x07, 0x41, 0x09, 0x42, 0x30, 0x42, 0x09, 0x25,
+    /*"d",68*/
+    0x01, 0x0A, 0x0D, 0x14, 0x14, 0x15, 0x2E, 0x24, 0x24, 0x24, 0x2E, 0x02,
+    /*"e",69*/
+    0x04, 0x07, 0x25, 0x09, 0x4C, 0x31, 0x30, 0x38, 0x08,
+    /*"f",70*/
+    0x01, 0x0A, 0x63, 0x01, 0x01, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F,
+    /*"g",71*/
+    0x04, 0x0A, 0x02, 0x2E, 0x24, 0x24, 0x24, 0x2E, 0x15, 0x14, 0x14, 0x25,
+    /*"h",72*/
+    0x01, 0x0A, 0x61, 0x22, 0x22, 0x16, 0x2B, 0x09, 0x09, 0x09, 0x09, 0x44,
+    /*"i",73*/
+    0x01, 0x0A, 0x1B, 0x1B, 0x00, 0x0B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x05,
+    /*"j",74*/
+    0x01, 0x0D, 0x1B, 0x1B, 0x00, 0x0E, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x23,
+    /*"k",75*/
+    0x01, 0x0A, 0x61, 0x22, 0x22, 0x55, 0x47, 0x2F, 0x2F, 0x47, 0x17, 0x64,
+    /*"l",76*/
+    0x01, 0x0A, 0x0B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x05,
+    /*"m",77*/
+    0x04, 0x07, 0x3D, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66,
+    /*"n",78*/
+    0x04, 0x07, 0x62, 0x2B, 0x09, 0x09, 0x09, 0x09, 0x44,
+    /*"o",79*/
+    0x04, 0x07, 0x25, 0x09, 0x4C, 0x4C, 0x4C, 0x09, 0x25,
+    /*"p",80*/
+    0x04, 0x0A, 0x62, 0x2B, 0x38, 0x38, 0x38, 0x2B, 0x16, 0x22, 0x22, 0x40,
+    /*"q",81*/
+    0x04, 0x0A, 0x02, 0x2E, 0x24, 0x24, 0x24, 0x2E, 0x15, 0x14, 0x14, 0x67,
+    /*"r",82*/
+    0x04, 0x07, 0x68, 0x69, 0x0F, 0x0F, 0x0F, 0x0F, 0x2C,
+    /*"s",83*/
+    0x04, 0x07, 0x08, 0x09, 0x2F, 0x25, 0x0D, 0x09, 0x0E,
+    /*"t",84*/
+    0x01, 0x0A, 0x0F, 0x0F, 0x0F, 0x2C, 0x0F, 0x0F, 0x0F, 0x0F, 0x5E, 0x0C,
+    /*"u",85*/
+    0x04, 0x07, 0x6A, 0x09, 0x09, 0x09, 0x09, 0x2E, 0x02,
+    /*"v",86*/
+    0x04, 0x07, 0x44, 0x09, 0x09, 0x06, 0x06, 0x1C, 0x1C,
+    /*"w",87*/
+    0x04, 0x07, 0x6B, 0x4C, 0x50, 0x4F, 0x5C, 0x5C, 0x09,
+    /*"x",88*/
+    0x04, 0x07, 0x44, 0x06, 0x1C, 0x1C, 0x1C, 0x06, 0x44,
+    /*"y",89*/
+    0x04, 0x0A, 0x39, 0x38, 0x1E, 0x1E, 0x26, 0x0C, 0x1B, 0x1B, 0x01, 0x23,
+    /*"z",90*/
+    0x04, 0x07, 0x1F, 0x2A, 0x1A, 0x1C, 0x0F, 0x3C, 0x1F,
+    /*"{",91*/
+    0x01, 0x0C, 0x1B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x1B,
+    /*"|",92*/
+    0x01, 0x0C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+    /*"}",93*/
+    0x01, 0x0C, 0x01, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x01,
+    /*"~",94*/
+    0x05, 0x03, 0x0F, 0x6C, 0x1A,
+};
+
+const uint16 FONT_EN_11X16_OFFSET[] =
+{
+    0, 18, 30, 37, 50, 65, 77, 88, 95, 109, 123, 132, 141, 148, 151, 155,
+    170, 182, 194, 206, 218, 230, 242, 254, 266, 278, 290, 299, 310, 321, 326, 337,
+    348, 361, 372, 383, 394, 405, 416, 427, 438, 449, 460, 471, 482, 493, 504, 515,
+    526, 537, 550, 561, 572, 583, 594, 605, 616, 627, 638, 649, 663, 678, 692, 700,
+    703, 708, 717, 729, 738, 750, 759, 771, 783, 795, 807, 822, 834, 846, 855, 864,
+    873, 885, 897, 906, 915, 927, 936, 945, 954, 963, 975, 984, 998, 1012, 1026,
+};
+
+const uint8 FONT_EN_14X20_ROWS[] =
+{
+    0x00, 0x00,
+    0x07, 0x00,
+    0x02, 0x00,
+    0x1C, 0xE0,
+    0x08, 0x40,
+    0x0C, 0xC0,
+    0x3F, 0xF0,
+    0x03, 0x00,
+    0x07, 0xE0,
+    0x0F, 0xE0,
+    0x18, 0x60,
+    0x18, 0x00,
+    0x1F, 0x00,
+    0x0F, 0xC0,
+    0x00, 0xE0,
+    0x1F, 0xC0,
+    0x1F, 0x80,
+    0x1C, 0x00,
+    0x22, 0x00,
+    0x1C, 0x60,
+    0x01, 0xE0,
+    0x0F, 0x80,
+    0x3C, 0x00,
+    0x31, 0xC0,
+    0x02, 0x20,
+    0x01, 0xC0,
+    0x03, 0xE0,
+    0x0C, 0x00,
+    0x06, 0x00,
+    0x0F, 0x30,
+    0x1F, 0xF0,
+    0x19, 0xE0,
+    0x18, 0xC0,
+    0x07, 0xB0,
+    0x03, 0x80,
+    0x01, 0x00,
+    0x00, 0xC0,
+    0x01, 0x80,
+    0x1B, 0x60,
+    0x1F, 0xE0,
+    0x07, 0x80,
+    0x04, 0x00,
+    0x3F, 0xE0,
+    0x00, 0x60,
+    0x30, 0x60,
+    0x38, 0xE0,
+    0x3F, 0xC0,
+    0x30, 0xE0,
+    0x07, 0xC0,
+    0x60, 0xE0,
+    0x7F, 0xC0,
+    0x3F, 0x80,
+    0x03, 0xC0,
+    0x06, 0xC0,
+    0x30, 0xC0,
+    0x18, 0xE0,
+    0x1E, 0x00,
+    0x38, 0x00,
+    0x37, 0x80,
+    0x0F, 0x00,
+    0x38, 0xC0,
+    0x0F, 0x60,
+    0x3E, 0x00,
+    0x00, 0x30,
+    0x00, 0xF0,
+    0x78, 0x00,
+    0x7F, 0xF0,
+    0x30, 0x00,
+    0x00, 0x78,
+    0x0C, 0x80,
+    0x10, 0x40,
+    0x11, 0xC0,
+    0x12, 0x40,
+    0x10, 0x00,
+    0x08, 0x00,
+    0x0C, 0x60,
+    0x30, 0x30,
+    0x78, 0x78,
+    0x18, 0x70,
+    0x18, 0x30,
+    0x0F, 0xF0,
+    0x1C, 0x70,
+    0x38, 0x30,
+    0x7F, 0x80,
+    0x30, 0x70,
+    0x19, 0x80,
+    0x3F, 0x00,
+    0x31, 0xF8,
+    0x3C, 0xF0,
+    0x03, 0xF8,
+    0x3E, 0xF8,
+    0x1B, 0x00,
+    0x1D, 0x80,
+    0x3E, 0x78,
+    0x3E, 0x38,
+    0x0C, 0x30,
+    0x38, 0x70,
+    0x34, 0xB0,
+    0x37, 0xB0,
+    0x33, 0x30,
+    0x7C, 0xF8,
+    0x39, 0xF0,
+    0x3D, 0xF0,
+    0x1E, 0x60,
+    0x3E, 0xE0,
+    0x3E, 0x60,
+    0x0C, 0xE0,
+    0x3E, 0x18,
+    0x0F, 0xB0,
+    0x00, 0x70,
+    0x37, 0xC0,
+    0x78, 0xF0,
+    0x0D, 0x80,
+    0x7C, 0x7C,
+    0x30, 0x18,
+    0x33, 0x98,
+    0x36, 0xD8,
+    0x16, 0xD0,
+    0x20, 0x20,
+    0xFF, 0xFC,
+    0x00, 0x80,
+    0x38, 0x60,
+    0x1F, 0x70,
+    0x70, 0x00,
+    0x7F, 0xE0,
+    0x77, 0x80,
+    0x1F, 0xF8,
+    0x07, 0xB8,
+    0x03, 0xF0,
+    0x07, 0xF0,
+    0x1B, 0xC0,
+    0x1B, 0xE0,
+    0x7E, 0xE0,
+    0x7B, 0xB8,
+    0x3B, 0xC0,
+    0x7C, 0x00,
+    0x00, 0xF8,
+    0x3C, 0xE0,
+    0x0E, 0x00,
+    0x0F, 0x70,
+    0x32, 0x60,
+    0x37, 0xE0,
+    0x1D, 0xC0,
+    0x7F, 0x00,
+    0x3F, 0x30,
+    0x33, 0xF0,
+};
+
+const uint8 FONT_EN_14X20_GLYPH[] =
+{
+    /*" ",0*/
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"!",1*/
+    0x01, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01,
+    /*""",2*/
+    0x02, 0x06, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04,
+    /*"#",3*/
+    0x00, 0x10, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x05, 0x05, 0x05,
+    0x05, 0x05,
+    /*"$",4*/
+    0x00, 0x10, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0A, 0x0A, 0x0F, 0x10, 0x07,
+    0x07, 0x07,
+    /*"%",5*/
+    0x01, 0x0D, 0x11, 0x12, 0x12, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x18, 0x18, 0x19,
+    /*"&",6*/
+    0x03, 0x0B, 0x1A, 0x09, 0x1B, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x1E, 0x21,
+    /*"'",7*/
+    0x02, 0x06, 0x22, 0x22, 0x22, 0x23, 0x23, 0x23,
+    /*"(",8*/
+    0x01, 0x10, 0x24, 0x24, 0x25, 0x25, 0x25, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x25, 0x25, 0x25,
+    0x24, 0x24,
+    /*")",9*/
+    0x01, 0x10, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1C, 0x1C, 0x1C,
+    0x1B, 0x1B,
+    /*"*",10*/
+    0x01, 0x09, 0x07, 0x07, 0x07, 0x26, 0x27, 0x28, 0x28, 0x0D, 0x05,
+    /*"+",11*/
+    0x03, 0x0A, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07,
+    /*",",12*/
+    0x0B, 0x06, 0x22, 0x07, 0x07, 0x1C, 0x1C, 0x29,
+    /*"-",13*/
+    0x07, 0x02, 0x2A, 0x2A,
+    /*".",14*/
+    0x0B, 0x03, 0x22, 0x22, 0x22,
+    /*"/",15*/
+    0x00, 0x10, 0x2B, 0x2B, 0x24, 0x24, 0x24, 0x25, 0x25, 0x07, 0x07, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B,
+    0x0B, 0x0B,
+    /*"0",16*/
+    0x01, 0x0D, 0x15, 0x0F, 0x20, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x20, 0x0F, 0x15,
+    /*"1",17*/
+    0x01, 0x0D, 0x07, 0x0C, 0x0C, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x27,
+    /*"2",18*/
+    0x01, 0x0D, 0x15, 0x0F, 0x2D, 0x2C, 0x2B, 0x24, 0x25, 0x07, 0x1C, 0x1B, 0x0B, 0x2A, 0x2A,
+    /*"3",19*/
+    0x01, 0x0D, 0x15, 0x2E, 0x2F, 0x2B, 0x0E, 0x30, 0x30, 0x0E, 0x2B, 0x2B, 0x31, 0x32, 0x33,
+    /*"4",20*/
+    0x01, 0x0D, 0x19, 0x34, 0x34, 0x35, 0x05, 0x05, 0x20, 0x36, 0x2A, 0x2A, 0x24, 0x1A, 0x1A,
+    /*"5",21*/
+    0x01, 0x0D, 0x0F, 0x0F, 0x0B, 0x0B, 0x10, 0x0F, 0x37, 0x2B, 0x2B, 0x2B, 0x2F, 0x2E, 0x10,
+    /*"6",22*/
+    0x01, 0x0D, 0x1A, 0x09, 0x38, 0x0B, 0x39, 0x3A, 0x2E, 0x2D, 0x2C, 0x2C, 0x37, 0x0F, 0x28,
+    /*"7",23*/
+    0x01, 0x0D, 0x2A, 0x2A, 0x2C, 0x2B, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x07, 0x07, 0x07,
+    /*"8",24*/
+    0x01, 0x0D, 0x15, 0x0F, 0x2D, 0x2C, 0x2D, 0x0F, 0x0F, 0x2D, 0x2C, 0x2C, 0x2D, 0x0F, 0x15,
+    /*"9",25*/
+    0x01, 0x0D, 0x3B, 0x0F, 0x3C, 0x2C, 0x2C, 0x2D, 0x27, 0x3D, 0x0E, 0x24, 0x34, 0x33, 0x3E,
+    /*":",26*/
+    0x05, 0x09, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22,
+    /*";",27*/
+    0x05, 0x0B, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x22, 0x07, 0x1C, 0x1C, 0x29,
+    /*"<",28*/
+    0x03, 0x0B, 0x3F, 0x40, 0x34, 0x01, 0x11, 0x41, 0x11, 0x01, 0x34, 0x40, 0x3F,
+    /*"=",29*/
+    0x05, 0x06, 0x42, 0x42, 0x00, 0x00, 0x42, 0x42,
+    /*">",30*/
+    0x03, 0x0B, 0x43, 0x16, 0x3B, 0x22, 0x0E, 0x44, 0x0E, 0x22, 0x3B, 0x16, 0x43,
+    /*"?",31*/
+    0x02, 0x0C, 0x15, 0x0F, 0x0A, 0x0A, 0x2B, 0x19, 0x22, 0x07, 0x00, 0x00, 0x01, 0x01,
+    /*"@",32*/
+    0x01, 0x0E, 0x22, 0x45, 0x04, 0x46, 0x46, 0x47, 0x48, 0x48, 0x48, 0x47, 0x49, 0x4A, 0x04, 0x28,
+    /*"A",33*/
+    0x02, 0x0C, 0x10, 0x10, 0x22, 0x35, 0x35, 0x05, 0x4B, 0x27, 0x27, 0x4C, 0x4D, 0x4D,
+    /*"B",34*/
+    0x02, 0x0C, 0x33, 0x2E, 0x0A, 0x0A, 0x37, 0x0F, 0x27, 0x4E, 0x4F, 0x4F, 0x06, 0x2A,
+    /*"C",35*/
+    0x02, 0x0C, 0x21, 0x50, 0x51, 0x52, 0x43, 0x43, 0x43, 0x43, 0x52, 0x51, 0x09, 0x30,
+    /*"D",36*/
+    0x02, 0x0C, 0x53, 0x32, 0x2F, 0x54, 0x4C, 0x4C, 0x4C, 0x4C, 0x54, 0x2F, 0x32, 0x53,
+    /*"E",37*/
+    0x02, 0x0C, 0x06, 0x06, 0x4F, 0x4F, 0x55, 0x10, 0x10, 0x55, 0x4F, 0x4F, 0x06, 0x06,
+    /*"F",38*/
+    0x02, 0x0C, 0x06, 0x06, 0x4F, 0x4F, 0x55, 0x10, 0x10, 0x55, 0x0B, 0x0B, 0x56, 0x56,
+    /*"G",39*/
+    0x02, 0x0C, 0x21, 0x1E, 0x4E, 0x4C, 0x43, 0x43, 0x57, 0x57, 0x4C, 0x4F, 0x1E, 0x30,
+    /*"H",40*/
+    0x02, 0x0C, 0x58, 0x58, 0x0A, 0x0A, 0x0A, 0x27, 0x27, 0x0A, 0x0A, 0x0A, 0x58, 0x58,
+    /*"I",41*/
+    0x02, 0x0C, 0x27, 0x27, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x27,
+    /*"J",42*/
+    0x02, 0x0C, 0x59, 0x59, 0x2B, 0x2B, 0x2B, 0x2B, 0x2C, 0x2C, 0x2C, 0x2F, 0x2E, 0x15,
+    /*"K",43*/
+    0x02, 0x0C, 0x5A, 0x5A, 0x37, 0x55, 0x5B, 0x0C, 0x5C, 0x20, 0x20, 0x0A, 0x5D, 0x5E,
+    /*"L",44*/
+    0x02, 0x0C, 0x56, 0x56, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x5F, 0x5F, 0x5F, 0x06, 0x06,
+    /*"M",45*/
+    0x02, 0x0C, 0x4D, 0x4D, 0x60, 0x58, 0x61, 0x62, 0x62, 0x63, 0x63, 0x4C, 0x64, 0x64,
+    /*"N",46*/
+    0x02, 0x0C, 0x65, 0x66, 0x13, 0x67, 0x67, 0x26, 0x26, 0x1F, 0x1F, 0x37, 0x68, 0x69,
+    /*"O",47*/
+    0x02, 0x0C, 0x28, 0x0D, 0x03, 0x60, 0x4C, 0x4C, 0x4C, 0x4C, 0x60, 0x03, 0x0D, 0x28,
+    /*"P",48*/
+    0x02, 0x0C, 0x2E, 0x2A, 0x4E, 0x4F, 0x4F, 0x4E, 0x27, 0x0F, 0x0B, 0x0B, 0x56, 0x56,
+    /*"Q",49*/
+    0x02, 0x0F, 0x28, 0x0D, 0x03, 0x60, 0x4C, 0x4C, 0x4C, 0x4C, 0x60, 0x03, 0x0D, 0x28, 0x21, 0x50,
+    0x6A,
+    /*"R",50*/
+    0x02, 0x0C, 0x2E, 0x2A, 0x4E, 0x4F, 0x4E, 0x27, 0x0F, 0x37, 0x0A, 0x4E, 0x5E, 0x6B,
+    /*"S",51*/
+    0x02, 0x0C, 0x6C, 0x1E, 0x60, 0x4C, 0x39, 0x10, 0x08, 0x6D, 0x4C, 0x60, 0x2A, 0x6E,
+    /*"T",52*/
+    0x02, 0x0C, 0x06, 0x06, 0x63, 0x63, 0x63, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0D, 0x0D,
+    /*"U",53*/
+    0x02, 0x0C, 0x58, 0x58, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x03, 0x0D, 0x28,
+    /*"V",54*/
+    0x02, 0x0C, 0x6F, 0x6F, 0x2C, 0x2C, 0x20, 0x20, 0x70, 0x70, 0x70, 0x01, 0x01, 0x01,
+    /*"W",55*/
+    0x02, 0x0C, 0x71, 0x71, 0x72, 0x73, 0x73, 0x73, 0x74, 0x75, 0x51, 0x51, 0x51, 0x4F,
+    /*"X",56*/
+    0x02, 0x0C, 0x6F, 0x6F, 0x2C, 0x20, 0x70, 0x01, 0x01, 0x70, 0x20, 0x2C, 0x6F, 0x6F,
+    /*"Y",57*/
+    0x02, 0x0C, 0x58, 0x58, 0x0A, 0x05, 0x28, 0x28, 0x07, 0x07, 0x07, 0x07, 0x0D, 0x0D,
+    /*"Z",58*/
+    0x02, 0x0C, 0x27, 0x27, 0x0A, 0x20, 0x25, 0x07, 0x07, 0x1C, 0x4B, 0x0A, 0x27, 0x27,
+    /*"[",59*/
+    0x01, 0x10, 0x34, 0x34, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x34, 0x34,
+    /*"\",60*/
+    0x00, 0x10, 0x0B, 0x0B, 0x1B, 0x1B, 0x1B, 0x1C, 0x1C, 0x07, 0x07, 0x25, 0x25, 0x24, 0x24, 0x24,
+    0x2B, 0x2B,
+    /*"]",61*/
+    0x01, 0x10, 0x3B, 0x3B, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x3B, 0x3B,
+    /*"^",62*/
+    0x01, 0x06, 0x02, 0x01, 0x70, 0x20, 0x2C, 0x76,
+    /*"_",63*/
+    0x12, 0x02, 0x77, 0x77,
+    /*"`",64*/
+    0x01, 0x03, 0x29, 0x07, 0x78,
+    /*"a",65*/
+    0x05, 0x09, 0x0D, 0x27, 0x2B, 0x09, 0x27, 0x79, 0x2F, 0x06, 0x7A,
+    /*"b",66*/
+    0x01, 0x0D, 0x7B, 0x7B, 0x43, 0x43, 0x3A, 0x2A, 0x79, 0x4C, 0x4C, 0x4C, 0x79, 0x7C, 0x7D,
+    /*"c",67*/
+    0x05, 0x09, 0x21, 0x1E, 0x4F, 0x4C, 0x43, 0x43, 0x52, 0x1E, 0x0D,
+    /*"d",68*/
+    0x01, 0x0D, 0x6D, 0x6D, 0x3F, 0x3F, 0x21, 0x1E, 0x4E, 0x4C, 0x4C, 0x4C, 0x60, 0x7E, 0x7F,
+    /*"e",69*/
+    0x05, 0x09, 0x28, 0x27, 0x0A, 0x06, 0x06, 0x43, 0x4F, 0x1E, 0x30,
+    /*"f",70*/
+    0x01, 0x0D, 0x80, 0x81, 0x1C, 0x1C, 0x27, 0x27, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x27, 0x27,
+    /*"g",71*/
+    0x05, 0x0D, 0x7F, 0x7E, 0x4E, 0x4C, 0x4C, 0x4C, 0x4E, 0x1E, 0x21, 0x3F, 0x6D, 0x09, 0x0D,
+    /*"h",72*/
+    0x01, 0x0D, 0x39, 0x39, 0x0B, 0x0B, 0x82, 0x27, 0x13, 0x0A, 0x0A, 0x0A, 0x0A, 0x58, 0x58,
+    /*"i",73*/
+    0x01, 0x0D, 0x07, 0x07, 0x00, 0x00, 0x0C, 0x0C, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x27,
+    /*"j",74*/
+    0x01, 0x11, 0x07, 0x07, 0x00, 0x00, 0x0F, 0x0F, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x19, 0x33, 0x56,
+    /*"k",75*/
+    0x01, 0x0D, 0x39, 0x39, 0x0B, 0x0B, 0x83, 0x83, 0x5B, 0x38, 0x38, 0x5B, 0x55, 0x65, 0x65,
+    /*"l",76*/
+    0x01, 0x0D, 0x0C, 0x0C, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x27, 0x27,
+    /*"m",77*/
+    0x05, 0x09, 0x84, 0x42, 0x63, 0x63, 0x63, 0x63, 0x63, 0x85, 0x85,
+    /*"n",78*/
+    0x05, 0x09, 0x86, 0x2A, 0x13, 0x0A, 0x0A, 0x0A, 0x0A, 0x58, 0x58,
+    /*"o",79*/
+    0x05, 0x09, 0x28, 0x27, 0x0A, 0x4C, 0x4C, 0x4C, 0x0A, 0x27, 0x28,
+    /*"p",80*/
+    0x05, 0x0D, 0x7D, 0x7C, 0x79, 0x4C, 0x4C, 0x4C, 0x79, 0x2A, 0x3A, 0x43, 0x43, 0x87, 0x87,
+    /*"q",81*/
+    0x05, 0x0D, 0x7F, 0x7E, 0x4E, 0x4C, 0x4C, 0x4C, 0x4E, 0x1E, 0x21, 0x3F, 0x3F, 0x88, 0x88,
+    /*"r",82*/
+    0x05, 0x09, 0x89, 0x66, 0x1D, 0x8A, 0x1B, 0x1B, 0x1B, 0x2E, 0x2E,
+    /*"s",83*/
+    0x05, 0x09, 0x08, 0x27, 0x0A, 0x38, 0x0D, 0x14, 0x0A, 0x27, 0x10,
+    /*"t",84*/
+    0x02, 0x0C, 0x1B, 0x1B, 0x1B, 0x2A, 0x2A, 0x1B, 0x1B, 0x1B, 0x1B, 0x5F, 0x50, 0x30,
+    /*"u",85*/
+    0x05, 0x09, 0x2D, 0x2D, 0x0A, 0x0A, 0x0A, 0x0A, 0x37, 0x1E, 0x8B,
+    /*"v",86*/
+    0x05, 0x09, 0x6F, 0x6F, 0x2C, 0x20, 0x20, 0x70, 0x70, 0x01, 0x01,
+    /*"w",87*/
+    0x05, 0x09, 0x6F, 0x6F, 0x8C, 0x8C, 0x8D, 0x8E, 0x8E, 0x20, 0x20,
+    /*"x",88*/
+    0x05, 0x09, 0x58, 0x58, 0x05, 0x28, 0x07, 0x28, 0x05, 0x58, 0x58,
+    /*"y",89*/
+    0x05, 0x0D, 0x6F, 0x6F, 0x2C, 0x20, 0x20, 0x70, 0x15, 0x01, 0x1C, 0x1C, 0x1B, 0x8F, 0x8F,
+    /*"z",90*/
+    0x05, 0x09, 0x27, 0x27, 0x20, 0x25, 0x07, 0x1C, 0x4B, 0x27, 0x27,
+    /*"{",91*/
+    0x01, 0x10, 0x19, 0x34, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x8A, 0x01, 0x07, 0x07, 0x07, 0x07,
+    0x34, 0x19,
+    /*"|",92*/
+    0x01, 0x10, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07,
+    /*"}",93*/
+    0x01, 0x10, 0x11, 0x38, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x01, 0x22, 0x01, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x38, 0x11,
+    /*"~",94*/
+    0x06, 0x04, 0x8A, 0x90, 0x91, 0x14,
+};
+
+const uint16 FONT_EN_14X20_OFFSET[] =
+{
+    0, 22, 37, 45, 63, 81, 96, 109, 117, 135, 153, 164, 176, 184, 188, 193,
+    211, 226, 241, 256, 271, 286, 301, 316, 331, 346, 361, 372, 385, 398, 406, 419,
+    433, 449, 463, 477, 491, 505, 519, 533, 547, 561, 575, 589, 603, 617, 631, 645,
+    659, 673, 690, 704, 718, 732, 746, 760, 774, 788, 802, 816, 834, 852, 870, 878,
+    882, 887, 898, 913, 924, 939, 950, 965, 980, 995, 1010, 1029, 1044, 1059, 1070, 1081,
+    1092, 1107, 1122, 1133, 1144, 1158, 1169, 1180, 1191, 1202, 1217, 1228, 1246, 1264, 1282,
+};
+
+const uint8 FONT_EN_17X24_ROWS[] =
+{
+    0x00, 0x00, 0x00,
+    0x03, 0x80, 0x00,
+    0x01, 0x00, 0x00,
+    0x0E, 0x70, 0x00,
+    0x04, 0x20, 0x00,
+    0x06, 0x60, 0x00,
+    0x3F, 0xF8, 0x00,
+    0x0C, 0xC0, 0x00,
+    0x01, 0x80, 0x00,
+    0x07, 0xB0, 0x00,
+    0x0F, 0xF0, 0x00,
+    0x18, 0x70, 0x00,
+    0x1C, 0x00, 0x00,
+    0x0F, 0x80, 0x00,
+    0x07, 0xE0, 0x00,
+    0x00, 0xF0, 0x00,
+    0x18, 0x30, 0x00,
+    0x1C, 0x30, 0x00,
+    0x1C, 0x70, 0x00,
+    0x1F, 0xE0, 0x00,
+    0x1B, 0xC0, 0x00,
+    0x07, 0x80, 0x00,
+    0x0F, 0xC0, 0x00,
+    0x1C, 0xE0, 0x00,
+    0x18, 0x60, 0x00,
+    0x0F, 0xF8, 0x00,
+    0x1F, 0xF0, 0x00,
+    0x07, 0x38, 0x00,
+    0x06, 0x18, 0x00,
+    0x03, 0xF0, 0x00,
+    0x01, 0xE0, 0x00,
+    0x07, 0xF0, 0x00,
+    0x0C, 0x60, 0x00,
+    0x0C, 0x00, 0x00,
+    0x06, 0x00, 0x00,
+    0x07, 0x00, 0x00,
+    0x0F, 0x9C, 0x00,
+    0x1D, 0xFC, 0x00,
+    0x18, 0xF0, 0x00,
+    0x0F, 0xFC, 0x00,
+    0x07, 0xDC, 0x00,
+    0x00, 0x18, 0x00,
+    0x00, 0x38, 0x00,
+    0x00, 0x70, 0x00,
+    0x00, 0xE0, 0x00,
+    0x01, 0xC0, 0x00,
+    0x18, 0x00, 0x00,
+    0x0E, 0x00, 0x00,
+    0x0F, 0x00, 0x00,
+    0x1D, 0xB8, 0x00,
+    0x1F, 0xF8, 0x00,
+    0x03, 0xC0, 0x00,
+    0x3F, 0xFC, 0x00,
+    0x00, 0xC0, 0x00,
+    0x03, 0x00, 0x00,
+    0x00, 0x30, 0x00,
+    0x00, 0x60, 0x00,
+    0x0C, 0x30, 0x00,
+    0x18, 0x18, 0x00,
+    0x00, 0x80, 0x00,
+    0x1F, 0x80, 0x00,
+    0x1D, 0x80, 0x00,
+    0x07, 0xC0, 0x00,
+    0x38, 0x30, 0x00,
+    0x30, 0x18, 0x00,
+    0x0F, 0xE0, 0x00,
+    0x0C, 0x70, 0x00,
+    0x03, 0xE0, 0x00,
+    0x18, 0x38, 0x00,
+    0x03, 0x60, 0x00,
+    0x30, 0x60, 0x00,
+    0x03, 0xF8, 0x00,
+    0x30, 0x30, 0x00,
+    0x3F, 0xF0, 0x00,
+    0x00, 0xF8, 0x00,
+    0x0C, 0x38, 0x00,
+    0x1C, 0x38, 0x00,
+    0x03, 0xD8, 0x00,
+    0x1F, 0xC0, 0x00,
+    0x1F, 0x00, 0x00,
+    0x02, 0x00, 0x00,
+    0x00, 0x1C, 0x00,
+    0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x00,
+    0xF0, 0x00, 0x00,
+    0x7F, 0xFC, 0x00,
+    0x70, 0x00, 0x00,
+    0x78, 0x00, 0x00,
+    0x1E, 0x00, 0x00,
+    0x00, 0x78, 0x00,
+    0x00, 0x1E, 0x00,
+    0x0E, 0x38, 0x00,
+    0x0C, 0x18, 0x00,
+    0x18, 0x78, 0x00,
+    0x18, 0xF8, 0x00,
+    0x19, 0xD8, 0x00,
+    0x19, 0x98, 0x00,
+    0x0E, 0x18, 0x00,
+    0x07, 0xF8, 0x00,
+    0x06, 0x30, 0x00,
+    0x18, 0x0C, 0x00,
+    0x30, 0x0C, 0x00,
+    0xFC, 0x7F, 0x00,
+    0x7F, 0xE0, 0x00,
+    0x7F, 0xF0, 0x00,
+    0x18, 0x1C, 0x00,
+    0x7F, 0xF8, 0x00,
+    0x03, 0xEC, 0x00,
+    0x1C, 0x1C, 0x00,
+    0x30, 0x00, 0x00,
+    0x7F, 0xC0, 0x00,
+    0x19, 0x80, 0x00,
+    0x0C, 0x0C, 0x00,
+    0x0C, 0xCC, 0x00,
+    0x3F, 0xC0, 0x00,
+    0x30, 0xFE, 0x00,
+    0x38, 0x0C, 0x00,
+    0x7E, 0x7E, 0x00,
+    0x07, 0xFE, 0x00,
+    0x3F, 0xE0, 0x00,
+    0x7F, 0x3E, 0x00,
+    0x18, 0xC0, 0x00,
+    0x1B, 0x80, 0x00,
+    0x7F, 0x1F, 0x00,
+    0x7F, 0x80, 0x00,
+    0xF0, 0x0F, 0x00,
+    0xF8, 0x1F, 0x00,
+    0x38, 0x1C, 0x00,
+    0x3C, 0x3C, 0x00,
+    0x36, 0x6C, 0x00,
+    0x33, 0xCC, 0x00,
+    0x31, 0x8C, 0x00,
+    0xFE, 0x7F, 0x00,
+    0x78, 0xFE, 0x00,
+    0x1C, 0x18, 0x00,
+    0x1E, 0x18, 0x00,
+    0x1F, 0x18, 0x00,
+    0x1B, 0x18, 0x00,
+    0x1B, 0x98, 0x00,
+    0x18, 0xD8, 0x00,
+    0x7F, 0x18, 0x00,
+    0x0C, 0x1C, 0x00,
+    0x07, 0xCC, 0x00,
+    0x18, 0xE0, 0x00,
+    0x7F, 0x1E, 0x00,
+    0x7F, 0x0E, 0x00,
+    0x07, 0xD8, 0x00,
+    0x1B, 0xE0, 0x00,
+    0x7F, 0x7F, 0x00,
+    0xFE, 0x3F, 0x80,
+    0x30, 0x06, 0x00,
+    0x30, 0x86, 0x00,
+    0x19, 0xCC, 0x00,
+    0x1B, 0x6C, 0x00,
+    0x1E, 0x7C, 0x00,
+    0x7C, 0x7E, 0x00,
+    0x01, 0xF0, 0x00,
+    0x07, 0x70, 0x00,
+    0x10, 0x04, 0x00,
+    0xFF, 0xFF, 0x00,
+    0x30, 0x70, 0x00,
+    0x1F, 0xFC, 0x00,
+    0x0F, 0xBC, 0x00,
+    0x7B, 0xE0, 0x00,
+    0x1F, 0xFE, 0x00,
+    0x07, 0xDE, 0x00,
+    0x01, 0xFC, 0x00,
+    0x03, 0xFC, 0x00,
+    0x0C, 0xF8, 0x00,
+    0x0D, 0x80, 0x00,
+    0x0D, 0xC0, 0x00,
+    0x0C, 0xE0, 0x00,
+    0x3C, 0x7C, 0x00,
+    0xF7, 0x78, 0x00,
+    0xFF, 0xFC, 0x00,
+    0x39, 0xCC, 0x00,
+    0xFD, 0xEF, 0x00,
+    0x7F, 0x00, 0x00,
+    0x00, 0xFE, 0x00,
+    0x3E, 0x78, 0x00,
+    0x3E, 0xFC, 0x00,
+    0x07, 0xFC, 0x00,
+    0x78, 0x78, 0x00,
+    0x0F, 0xFE, 0x00,
+    0x7C, 0x3E, 0x00,
+    0x78, 0x3C, 0x00,
+    0x31, 0x18, 0x00,
+    0x33, 0x98, 0x00,
+    0x1A, 0xB0, 0x00,
+    0x1E, 0xF0, 0x00,
+    0x1C, 0x60, 0x00,
+    0x3E, 0x7C, 0x00,
+    0x7E, 0x1F, 0x00,
+    0x3B, 0xB8, 0x00,
+    0x31, 0xF0, 0x00,
+};
+
+const uint8 FONT_EN_17X24_GLYPH[] =
+{
+    /*" ",0*/
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /*"!",1*/
+    0x02, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01,
+    0x01,
+    /*""",2*/
+    0x03, 0x07, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04,
+    /*"#",3*/
+    0x02, 0x10, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x05, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07,
+    0x07, 0x07,
+    /*"$",4*/
+    0x01, 0x13, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x08, 0x08, 0x08, 0x08,
+    /*"%",5*/
+    0x02, 0x0F, 0x15, 0x16, 0x17, 0x18, 0x18, 0x17, 0x19, 0x0E, 0x1A, 0x1B, 0x1C, 0x1C, 0x1B, 0x1D,
+    0x1E,
+    /*"&",6*/
+    0x04, 0x0D, 0x1D, 0x1F, 0x20, 0x21, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x0B, 0x27, 0x28,
+    /*"'",7*/
+    0x03, 0x07, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    /*"(",8*/
+    0x02, 0x12, 0x29, 0x2A, 0x2B, 0x0F, 0x2C, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2C,
+    0x2B, 0x2B, 0x2A, 0x29,
+    /*")",9*/
+    0x02, 0x12, 0x2E, 0x0C, 0x2F, 0x2F, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23,
+    0x30, 0x2F, 0x0C, 0x2E,
+    /*"*",10*/
+    0x02, 0x0A, 0x08, 0x08, 0x08, 0x31, 0x32, 0x0E, 0x33, 0x33, 0x05, 0x05,
+    /*"+",11*/
+    0x04, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x34, 0x34, 0x08, 0x08, 0x08, 0x08, 0x08,
+    /*",",12*/
+    0x0E, 0x07, 0x2C, 0x35, 0x2D, 0x08, 0x08, 0x36, 0x36,
+    /*"-",13*/
+    0x09, 0x02, 0x32, 0x32,
+    /*".",14*/
+    0x0E, 0x03, 0x33, 0x33, 0x33,
+    /*"/",15*/
+    0x00, 0x14, 0x29, 0x29, 0x2A, 0x37, 0x2B, 0x38, 0x38, 0x35, 0x35, 0x08, 0x08, 0x36, 0x36, 0x22,
+    0x22, 0x2F, 0x21, 0x0C, 0x2E, 0x2E,
+    /*"0",16*/
+    0x02, 0x0F, 0x33, 0x0E, 0x39, 0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x39, 0x39, 0x0E,
+    0x33,
+    /*"1",17*/
+    0x02, 0x0F, 0x3B, 0x15, 0x3C, 0x3D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x32,
+    0x32,
+    /*"2",18*/
+    0x02, 0x0F, 0x3E, 0x1A, 0x3F, 0x40, 0x40, 0x29, 0x37, 0x38, 0x2D, 0x01, 0x22, 0x21, 0x2E, 0x06,
+    0x06,
+    /*"3",19*/
+    0x02, 0x0F, 0x33, 0x41, 0x42, 0x37, 0x37, 0x38, 0x33, 0x43, 0x2B, 0x29, 0x29, 0x29, 0x44, 0x1A,
+    0x16,
+    /*"4",20*/
+    0x02, 0x0F, 0x2C, 0x1E, 0x1E, 0x45, 0x05, 0x05, 0x20, 0x20, 0x18, 0x46, 0x06, 0x06, 0x38, 0x47,
+    0x47,
+    /*"5",21*/
+    0x02, 0x0F, 0x1A, 0x1A, 0x2E, 0x2E, 0x2E, 0x14, 0x1A, 0x11, 0x29, 0x29, 0x29, 0x29, 0x48, 0x49,
+    0x16,
+    /*"6",22*/
+    0x02, 0x0F, 0x4A, 0x47, 0x23, 0x2F, 0x21, 0x2E, 0x14, 0x1A, 0x11, 0x3A, 0x3A, 0x3A, 0x4B, 0x0A,
+    0x43,
+    /*"7",23*/
+    0x02, 0x0F, 0x32, 0x32, 0x3A, 0x44, 0x37, 0x37, 0x2B, 0x38, 0x38, 0x2C, 0x35, 0x35, 0x2D, 0x08,
+    0x08,
+    /*"8",24*/
+    0x02, 0x0F, 0x0E, 0x0A, 0x4C, 0x3A, 0x3A, 0x39, 0x0E, 0x0E, 0x39, 0x3A, 0x3A, 0x3A, 0x4C, 0x0A,
+    0x0E,
+    /*"9",25*/
+    0x02, 0x0F, 0x3E, 0x0A, 0x11, 0x3A, 0x3A, 0x3A, 0x4B, 0x19, 0x4D, 0x29, 0x37, 0x2B, 0x2C, 0x4E,
+    0x4F,
+    /*":",26*/
+    0x06, 0x0B, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33,
+    /*";",27*/
+    0x06, 0x0D, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2D, 0x08, 0x08, 0x36, 0x50,
+    /*"<",28*/
+    0x04, 0x0D, 0x51, 0x52, 0x0F, 0x33, 0x30, 0x53, 0x54, 0x53, 0x30, 0x33, 0x0F, 0x52, 0x51,
+    /*"=",29*/
+    0x07, 0x06, 0x55, 0x55, 0x00, 0x00, 0x55, 0x55,
+    /*">",30*/
+    0x04, 0x0D, 0x56, 0x57, 0x58, 0x15, 0x1E, 0x59, 0x5A, 0x59, 0x1E, 0x15, 0x58, 0x57, 0x56,
+    /*"?",31*/
+    0x03, 0x0E, 0x3E, 0x41, 0x0B, 0x10, 0x10, 0x2B, 0x2C, 0x33, 0x01, 0x36, 0x00, 0x00, 0x23, 0x23,
+    /*"@",32*/
+    0x02, 0x11, 0x43, 0x1F, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x60, 0x60, 0x5E, 0x5D, 0x2E, 0x21,
+    0x61, 0x62, 0x43,
+    /*"A",33*/
+    0x03, 0x0E, 0x3C, 0x4E, 0x2D, 0x45, 0x45, 0x63, 0x63, 0x39, 0x19, 0x32, 0x64, 0x65, 0x66, 0x66,
+    /*"B",34*/
+    0x03, 0x0E, 0x67, 0x68, 0x44, 0x3A, 0x3A, 0x44, 0x1A, 0x32, 0x69, 0x64, 0x64, 0x64, 0x6A, 0x68,
+    /*"C",35*/
+    0x03, 0x0E, 0x6B, 0x27, 0x6C, 0x64, 0x65, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x64, 0x6C, 0x19, 0x1D,
+    /*"D",36*/
+    0x03, 0x0E, 0x6E, 0x68, 0x44, 0x3A, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x3A, 0x44, 0x68, 0x67,
+    /*"E",37*/
+    0x03, 0x0E, 0x6A, 0x6A, 0x3A, 0x3A, 0x60, 0x6F, 0x3C, 0x3C, 0x6F, 0x60, 0x3A, 0x3A, 0x6A, 0x6A,
+    /*"F",38*/
+    0x03, 0x0E, 0x34, 0x34, 0x70, 0x70, 0x71, 0x07, 0x16, 0x16, 0x07, 0x07, 0x21, 0x21, 0x72, 0x72,
+    /*"G",39*/
+    0x03, 0x0E, 0x6B, 0x27, 0x6C, 0x64, 0x65, 0x6D, 0x6D, 0x73, 0x73, 0x65, 0x74, 0x6C, 0x27, 0x1D,
+    /*"H",40*/
+    0x03, 0x0E, 0x75, 0x75, 0x3A, 0x3A, 0x3A, 0x3A, 0x32, 0x32, 0x3A, 0x3A, 0x3A, 0x3A, 0x75, 0x75,
+    /*"I",41*/
+    0x03, 0x0E, 0x32, 0x32, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x32, 0x32,
+    /*"J",42*/
+    0x03, 0x0E, 0x76, 0x76, 0x37, 0x37, 0x37, 0x37, 0x37, 0x48, 0x48, 0x48, 0x48, 0x46, 0x77, 0x0D,
+    /*"K",43*/
+    0x03, 0x0E, 0x78, 0x78, 0x10, 0x18, 0x79, 0x6F, 0x7A, 0x4E, 0x17, 0x0B, 0x10, 0x44, 0x7B, 0x7B,
+    /*"L",44*/
+    0x03, 0x0E, 0x7C, 0x7C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x70, 0x70, 0x70, 0x70, 0x55, 0x55,
+    /*"M",45*/
+    0x03, 0x0E, 0x7D, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x65, 0x65, 0x84, 0x84,
+    /*"N",46*/
+    0x03, 0x0E, 0x85, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x5F, 0x8B, 0x5E, 0x5D, 0x44, 0x8C, 0x8C,
+    /*"O",47*/
+    0x03, 0x0E, 0x33, 0x0A, 0x4C, 0x3A, 0x7F, 0x65, 0x65, 0x65, 0x65, 0x7F, 0x3A, 0x4C, 0x0A, 0x33,
+    /*"P",48*/
+    0x03, 0x0E, 0x49, 0x06, 0x8D, 0x70, 0x70, 0x70, 0x5C, 0x19, 0x41, 0x21, 0x21, 0x21, 0x72, 0x72,
+    /*"Q",49*/
+    0x03, 0x11, 0x33, 0x0A, 0x4C, 0x3A, 0x7F, 0x65, 0x65, 0x65, 0x65, 0x7F, 0x3A, 0x4C, 0x0A, 0x3E,
+    0x8E, 0x27, 0x4B,
+    /*"R",50*/
+    0x03, 0x0E, 0x67, 0x68, 0x44, 0x3A, 0x3A, 0x44, 0x1A, 0x4E, 0x8F, 0x0B, 0x10, 0x44, 0x90, 0x91,
+    /*"S",51*/
+    0x03, 0x0E, 0x92, 0x19, 0x4C, 0x3A, 0x3A, 0x58, 0x16, 0x1D, 0x59, 0x3A, 0x3A, 0x4C, 0x1A, 0x93,
+    /*"T",52*/
+    0x03, 0x0E, 0x34, 0x34, 0x83, 0x83, 0x83, 0x83, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0A, 0x0A,
+    /*"U",53*/
+    0x03, 0x0E, 0x75, 0x75, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x39, 0x0A, 0x33,
+    /*"V",54*/
+    0x03, 0x0E, 0x94, 0x94, 0x64, 0x5C, 0x5C, 0x5C, 0x63, 0x63, 0x45, 0x45, 0x45, 0x2D, 0x2D, 0x3B,
+    /*"W",55*/
+    0x03, 0x0E, 0x95, 0x95, 0x96, 0x96, 0x97, 0x98, 0x98, 0x99, 0x99, 0x9A, 0x5B, 0x5B, 0x5C, 0x5C,
+    /*"X",56*/
+    0x03, 0x0E, 0x75, 0x75, 0x3A, 0x39, 0x05, 0x33, 0x08, 0x08, 0x33, 0x05, 0x39, 0x3A, 0x75, 0x75,
+    /*"Y",57*/
+    0x03, 0x0E, 0x9B, 0x9B, 0x3A, 0x39, 0x05, 0x05, 0x33, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0A, 0x0A,
+    /*"Z",58*/
+    0x03, 0x0E, 0x32, 0x32, 0x3A, 0x10, 0x18, 0x79, 0x08, 0x36, 0x1C, 0x5C, 0x3A, 0x40, 0x06, 0x06,
+    /*"[",59*/
+    0x02, 0x12, 0x9C, 0x9C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x9C, 0x9C,
+    /*"\",60*/
+    0x00, 0x14, 0x2E, 0x2E, 0x0C, 0x21, 0x2F, 0x22, 0x22, 0x36, 0x36, 0x08, 0x08, 0x35, 0x35, 0x38,
+    0x38, 0x2B, 0x37, 0x2A, 0x29, 0x29,
+    /*"]",61*/
+    0x02, 0x12, 0x0D, 0x0D, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x0D, 0x0D,
+    /*"^",62*/
+    0x01, 0x08, 0x3B, 0x2D, 0x43, 0x9D, 0x63, 0x5C, 0x64, 0x9E,
+    /*"_",63*/
+    0x16, 0x02, 0x9F, 0x9F,
+    /*"`",64*/
+    0x01, 0x04, 0x36, 0x01, 0x2C, 0x38,
+    /*"a",65*/
+    0x06, 0x0B, 0x16, 0x13, 0x37, 0x37, 0x1F, 0x1A, 0x3F, 0x48, 0xA0, 0xA1, 0xA2,
+    /*"b",66*/
+    0x02, 0x0F, 0x57, 0x57, 0x2E, 0x2E, 0x93, 0x32, 0x86, 0x64, 0x64, 0x64, 0x64, 0x64, 0x86, 0x6A,
+    0xA3,
+    /*"c",67*/
+    0x06, 0x0B, 0x6B, 0x27, 0x6C, 0x74, 0x65, 0x6D, 0x6D, 0x74, 0x6C, 0x19, 0x1D,
+    /*"d",68*/
+    0x02, 0x0F, 0x59, 0x59, 0x29, 0x29, 0x92, 0x32, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x44, 0xA4,
+    0xA5,
+    /*"e",69*/
+    0x06, 0x0B, 0x0E, 0x32, 0x3A, 0x65, 0x34, 0x34, 0x6D, 0x6D, 0x64, 0xA1, 0x1F,
+    /*"f",70*/
+    0x02, 0x0F, 0xA6, 0xA7, 0x22, 0x22, 0x06, 0x06, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x49,
+    0x49,
+    /*"g",71*/
+    0x06, 0x10, 0xA5, 0xA4, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x44, 0x32, 0x92, 0x29, 0x29, 0x2A,
+    0x0A, 0x16,
+    /*"h",72*/
+    0x02, 0x0F, 0x57, 0x57, 0x2E, 0x2E, 0x93, 0x1A, 0x4C, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x75,
+    0x75,
+    /*"i",73*/
+    0x02, 0x0F, 0x08, 0x08, 0x00, 0x00, 0x3C, 0x3C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x34,
+    0x34,
+    /*"j",74*/
+    0x02, 0x14, 0x35, 0x35, 0x00, 0x00, 0x1A, 0x1A, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x2B, 0x13, 0x3C,
+    /*"k",75*/
+    0x02, 0x0F, 0x53, 0x53, 0x21, 0x21, 0xA8, 0xA8, 0x07, 0xA9, 0x0D, 0x30, 0x0D, 0xAA, 0xAB, 0xAC,
+    0xAC,
+    /*"l",76*/
+    0x02, 0x0F, 0x3C, 0x3C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x34,
+    0x34,
+    /*"m",77*/
+    0x06, 0x0B, 0xAD, 0xAE, 0xAF, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0xB0, 0xB0,
+    /*"n",78*/
+    0x06, 0x0B, 0xA3, 0x68, 0x4C, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x75, 0x75,
+    /*"o",79*/
+    0x06, 0x0B, 0x33, 0x0A, 0x4C, 0x7F, 0x65, 0x65, 0x65, 0x7F, 0x4C, 0x0A, 0x33,
+    /*"p",80*/
+    0x06, 0x10, 0xA3, 0x6A, 0x86, 0x64, 0x64, 0x64, 0x64, 0x64, 0x86, 0x32, 0x93, 0x2E, 0x2E, 0x2E,
+    0xB1, 0xB1,
+    /*"q",81*/
+    0x06, 0x10, 0xA5, 0xA4, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x44, 0x32, 0x92, 0x29, 0x29, 0x29,
+    0xB2, 0xB2,
+    /*"r",82*/
+    0x06, 0x0B, 0xB3, 0xB4, 0x8E, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x49, 0x49,
+    /*"s",83*/
+    0x06, 0x0B, 0x62, 0x19, 0x3A, 0x3A, 0x3C, 0x0A, 0x4A, 0x3A, 0x44, 0x1A, 0x13,
+    /*"t",84*/
+    0x02, 0x0F, 0x21, 0x21, 0x21, 0x21, 0x49, 0x49, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x8D, 0xB5,
+    0x1D,
+    /*"u",85*/
+    0x06, 0x0B, 0xB6, 0xB6, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x44, 0xB7, 0xA5,
+    /*"v",86*/
+    0x06, 0x0B, 0xB8, 0xB8, 0x3A, 0x3A, 0x39, 0x39, 0x05, 0x05, 0x0E, 0x33, 0x33,
+    /*"w",87*/
+    0x06, 0x0B, 0xB9, 0xB9, 0xBA, 0xBB, 0xBB, 0xBC, 0xBD, 0xBD, 0xBE, 0x20, 0x20,
+    /*"x",88*/
+    0x06, 0x0B, 0xBF, 0xBF, 0x39, 0x05, 0x33, 0x08, 0x33, 0x05, 0x39, 0xBF, 0xBF,
+    /*"y",89*/
+    0x06, 0x10, 0xC0, 0xC0, 0x64, 0x5C, 0x5C, 0x63, 0x63, 0x45, 0x43, 0x2D, 0x35, 0x08, 0x08, 0x36,
+    0x72, 0x72,
+    /*"z",90*/
+    0x06, 0x0B, 0x32, 0x32, 0x10, 0x18, 0x35, 0x08, 0x36, 0x1C, 0x5C, 0x32, 0x32,
+    /*"{",91*/
+    0x02, 0x12, 0x2C, 0x1E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x01, 0x23, 0x01, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x1E, 0x2C,
+    /*"|",92*/
+    0x02, 0x12, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08,
+    /*"}",93*/
+    0x02, 0x12, 0x23, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x2D, 0x2C, 0x2D, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x15, 0x23,
+    /*"~",94*/
+    0x08, 0x05, 0x2F, 0x88, 0xC1, 0xC2, 0x2C,
+};
+
+const uint16 FONT_EN_17X24_OFFSET[] =
+{
+    0, 26, 43, 52, 70, 91, 108, 123, 132, 152, 172, 184, 198, 207, 211, 216,
+    238, 255, 272, 289, 306, 323, 340, 357, 374, 391, 408, 421, 436, 451, 459, 474,
+    490, 509, 525, 541, 557, 573, 589, 605, 621, 637, 653, 669, 685, 701, 717, 733,
+    749, 765, 784, 800, 816, 832, 848, 864, 880, 896, 912, 928, 948, 970, 990, 1000,
+    1004, 1010, 1023, 1040, 1053, 1070, 1083, 1100, 1118, 1135, 1152, 1174, 1191, 1208, 1221, 1234,
+    1247, 1265, 1283, 1296, 1309, 1326, 1339, 1352, 1365, 1378, 1396, 1409, 1429, 1449, 1469,
+};
+
+font_t LED_FONT[FONT_MAX] =
+{
+    { FONT_5X7, 5, 7, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_5X7, NULL, NULL, 0 },
+    { FONT_5X8, 5, 8, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_5X8, NULL, NULL, 0 },
+    { FONT_7X12, 7, 12, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_7X12_GLYPH, FONT_EN_7X12_ROWS, FONT_EN_7X12_OFFSET, 0 },
+    { FONT_8X16, 8, 16, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_8X16_GLYPH, FONT_EN_8X16_ROWS, FONT_EN_8X16_OFFSET, 0 },
+    { FONT_11X16, 11, 16, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_11X16_GLYPH, FONT_EN_11X16_ROWS, FONT_EN_11X16_OFFSET, 0 },
+    { FONT_14X20, 14, 20, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_14X20_GLYPH, FONT_EN_14X20_ROWS, FONT_EN_14X20_OFFSET, 0 },
+    { FONT_17X24, 17, 24, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_17X24_GLYPH, FONT_EN_17X24_ROWS, FONT_EN_17X24_OFFSET, 0 },
+};
+
+#endif
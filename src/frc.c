@@ -0,0 +1,246 @@
+#include "frc.h"
+#include "lcd.h"
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+
+#define FRC_LEVEL_MAX (3 * FRC_CYCLE_MAX)
+
+static int32_t FRC_X0 = 0;
+static int32_t FRC_PAGE0 = 0;
+static int32_t FRC_WIDTH = 0;
+static int32_t FRC_HEIGHT = 0;
+static int32_t FRC_CYCLE = 0;
+static int64_t FRC_PERIOD_NS = 0;
+
+static uint8_t *FRC_SRC = NULL;  //最新提交的源帧, 已换算为 [0, 3 * cycle] 级
+static uint8_t *FRC_CUR = NULL;  //当前周期使用的源帧
+static int32_t FRC_PENDING = 0;
+
+//FRC_LUT[phase][v] = 子帧中的4级灰度, 已换成屏幕值(白0黑3)
+static uint8_t FRC_LUT[FRC_CYCLE_MAX][FRC_LEVEL_MAX + 1];
+
+static volatile int32_t FRC_RUN = 0;
+static pthread_t FRC_THREAD;
+static pthread_mutex_t FRC_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+static lcd_frc_stat_t FRC_STAT = {0};
+
+static int64_t frc_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static void frc_build_lut(int32_t cycle)
+{
+    int32_t phase = 0, v = 0;
+
+    //v 已经是 0为白 的灰度级, cycle个子帧的 (v + phase) / cycle 之和正好为 v
+    for (phase = 0; phase < cycle; phase++)
+    {
+        for (v = 0; v <= 3 * cycle; v++)
+        {
+            FRC_LUT[phase][v] = (uint8_t)((v + phase) / cycle);
+        }
+    }
+}
+
+/*
+ * frc_render:
+ *	Build subframe s of the current source into the framebuffer.
+ *	The phase is offset per pixel so neighbouring pixels toggle on
+ *	different subframes, which keeps the flicker spatially spread.
+ */
+static void frc_render(int32_t s)
+{
+    const uint8_t *row = NULL;
+    uint8_t *dst = NULL;
+    int32_t x = 0, y = 0, r = 0;
+    uint8_t b = 0;
+
+    for (y = 0; y < FRC_HEIGHT; y += LCD_DRV_PAGE_ROW)
+    {
+        dst = lcd_drv_get_page(FRC_PAGE0 + y / LCD_DRV_PAGE_ROW) + FRC_X0;
+        for (x = 0; x < FRC_WIDTH; x++)
+        {
+            b = 0;
+            for (r = 0; (r < LCD_DRV_PAGE_ROW) && ((y + r) < FRC_HEIGHT); r++)
+            {
+                row = FRC_CUR + (y + r) * FRC_WIDTH;
+                b |= (uint8_t)(FRC_LUT[(s + x + y + r) % FRC_CYCLE][row[x]] << ((LCD_DRV_PAGE_ROW - r - 1) * LCD_DRV_COLOUR_BIT));
+            }
+            dst[x] = b;
+        }
+    }
+    lcd_drv_mark_dirty(FRC_X0, FRC_PAGE0 * LCD_DRV_PAGE_ROW, FRC_WIDTH, FRC_HEIGHT);
+}
+
+static void *frc_presenter(void *arg)
+{
+    struct timespec ts;
+    int64_t deadline = 0, now = 0, t0 = 0;
+    int64_t win_start = 0;
+    uint32_t win_count = 0;
+    uint8_t *tmp = NULL;
+    int32_t s = 0;
+
+    (void)arg;
+    deadline = frc_now_ns();
+    win_start = deadline;
+    while (FRC_RUN)
+    {
+        //新源帧只在周期边界切换, 保证每个像素的cycle个子帧完整
+        if (s == 0)
+        {
+            pthread_mutex_lock(&FRC_LOCK);
+            if (FRC_PENDING)
+            {
+                tmp = FRC_CUR;
+                FRC_CUR = FRC_SRC;
+                FRC_SRC = tmp;
+                FRC_PENDING = 0;
+            }
+            pthread_mutex_unlock(&FRC_LOCK);
+        }
+
+        t0 = frc_now_ns();
+        lcd_lock();
+        frc_render(s);
+        lcd_flush();
+        lcd_unlock();
+        now = frc_now_ns();
+
+        pthread_mutex_lock(&FRC_LOCK);
+        FRC_STAT.subframes++;
+        FRC_STAT.flush_us = (uint32_t)((now - t0) / 1000);
+        win_count++;
+        if ((now - win_start) >= 1000000000)
+        {
+            FRC_STAT.rate_mhz = (uint32_t)(((int64_t)win_count * 1000000000000LL) / (now - win_start));
+            win_start = now;
+            win_count = 0;
+        }
+
+        deadline += FRC_PERIOD_NS;
+        if (now > deadline)
+        {
+            //传输跟不上, 从当前时刻重新对齐节拍, 不追赶
+            FRC_STAT.late++;
+            deadline = now;
+        }
+        pthread_mutex_unlock(&FRC_LOCK);
+
+        s = (s + 1) % FRC_CYCLE;
+
+        ts.tv_sec = deadline / 1000000000;
+        ts.tv_nsec = deadline % 1000000000;
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+    }
+
+    return NULL;
+}
+
+int32_t frc_init(int32_t x0, int32_t y0, int32_t width, int32_t height, int32_t cycle, int32_t rate)
+{
+    if ((FRC_RUN) || (x0 < 0) || (y0 < 0) || ((y0 % LCD_DRV_PAGE_ROW) != 0) || (width <= 0) || (height <= 0) ||
+        ((x0 + width) > LCD_DRV_MAX_X) || ((y0 + height) > LCD_DRV_MAX_Y) ||
+        (cycle < FRC_CYCLE_MIN) || (cycle > FRC_CYCLE_MAX) || (rate < 0))
+    {
+        return ERROR;
+    }
+
+    FRC_X0 = x0;
+    FRC_PAGE0 = y0 / LCD_DRV_PAGE_ROW;
+    FRC_WIDTH = width;
+    FRC_HEIGHT = height;
+    FRC_CYCLE = cycle;
+    FRC_PERIOD_NS = 1000000000LL / ((rate > 0) ? rate : FRC_RATE_DEFAULT);
+    FRC_PENDING = 0;
+    memset(&FRC_STAT, 0, sizeof(FRC_STAT));
+    frc_build_lut(cycle);
+
+    FRC_SRC = calloc((size_t)width * height, 1);
+    FRC_CUR = calloc((size_t)width * height, 1);
+    if ((FRC_SRC == NULL) || (FRC_CUR == NULL))
+    {
+        frc_dinit();
+        return ERROR;
+    }
+
+    FRC_RUN = 1;
+    if (pthread_create(&FRC_THREAD, NULL, frc_presenter, NULL) != 0)
+    {
+        FRC_RUN = 0;
+        frc_dinit();
+        return ERROR;
+    }
+
+    DEBUG_LOG("FRC %dx%d, [%d] subframes, [%d] levels, [%d]Hz.", width, height, cycle, 3 * cycle + 1,
+              (int32_t)(1000000000LL / FRC_PERIOD_NS));
+
+    return OK;
+}
+
+int32_t frc_dinit(void)
+{
+    if (FRC_RUN)
+    {
+        FRC_RUN = 0;
+        pthread_join(FRC_THREAD, NULL);
+        DEBUG_LOG("FRC subframes [%u] late [%u] rate [%u.%03u]Hz flush [%u]us.", FRC_STAT.subframes, FRC_STAT.late,
+                  FRC_STAT.rate_mhz / 1000, FRC_STAT.rate_mhz % 1000, FRC_STAT.flush_us);
+    }
+
+    free(FRC_SRC);
+    FRC_SRC = NULL;
+    free(FRC_CUR);
+    FRC_CUR = NULL;
+
+    return OK;
+}
+
+int32_t frc_submit(const uint8_t *gray, int32_t stride)
+{
+    int32_t x = 0, y = 0;
+    int32_t levels = 0;
+    uint8_t *dst = NULL;
+
+    if ((gray == NULL) || (FRC_SRC == NULL))
+    {
+        return ERROR;
+    }
+
+    levels = 3 * FRC_CYCLE;
+
+    pthread_mutex_lock(&FRC_LOCK);
+    for (y = 0; y < FRC_HEIGHT; y++)
+    {
+        dst = FRC_SRC + y * FRC_WIDTH;
+        for (x = 0; x < FRC_WIDTH; x++)
+        {
+            //0黑255白 -> [0, 3 * cycle], 0为白
+            dst[x] = (uint8_t)(((255 - gray[x]) * levels + 127) / 255);
+        }
+        gray += stride;
+    }
+    FRC_PENDING = 1;
+    pthread_mutex_unlock(&FRC_LOCK);
+
+    return OK;
+}
+
+int32_t frc_get_stat(lcd_frc_stat_t *stat)
+{
+    if (stat == NULL)
+    {
+        return ERROR;
+    }
+
+    pthread_mutex_lock(&FRC_LOCK);
+    *stat = FRC_STAT;
+    pthread_mutex_unlock(&FRC_LOCK);
+
+    return OK;
+}
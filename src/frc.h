@@ -0,0 +1,45 @@
+#ifndef _LCD_FRC_H_
+#define _LCD_FRC_H_
+
+#include "type.h"
+
+#define FRC_CYCLE_MIN (1)
+#define FRC_CYCLE_MAX (4)
+#define FRC_RATE_DEFAULT (60)
+
+typedef struct lcd_frc_stat_s
+{
+    uint32_t subframes; //已刷新的子帧数
+    uint32_t late;      //错过刷新时刻的子帧数
+    uint32_t rate_mhz;  //最近一秒实际达到的子帧率(mHz)
+    uint32_t flush_us;  //最近一次刷新耗时
+} lcd_frc_stat_t;
+
+/*****************************************************************************
+函 数 名  : frc_init
+功能描述  : 启动时间抖动(FRC)显示线程. 每个源帧被拆成cycle个4级灰度子帧轮流
+            刷新, 人眼积分后得到 3 * cycle + 1 级灰度(cycle=2为7级, 3为10级).
+            FRC线程在 lcd_lock 内渲染并刷新, 其他代码写同一区域会被覆盖.
+输入参数  : x0, y0  显示区域左上角, y0 必须页(4行)对齐
+            width   显示区域宽度
+            height  显示区域高度
+            cycle   子帧数 [FRC_CYCLE_MIN, FRC_CYCLE_MAX]
+            rate    目标子帧率(Hz), 0 为 FRC_RATE_DEFAULT
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t frc_init(int32_t x0, int32_t y0, int32_t width, int32_t height, int32_t cycle, int32_t rate);
+extern int32_t frc_dinit(void);
+
+/*****************************************************************************
+函 数 名  : frc_submit
+功能描述  : 提交一帧8bit灰度源图(0黑, 255白), 从下一个子帧周期开始显示
+输入参数  : gray    源图, width * height
+            stride  每行字节数
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t frc_submit(const uint8_t *gray, int32_t stride);
+extern int32_t frc_get_stat(lcd_frc_stat_t *stat);
+
+#endif
@@ -0,0 +1,225 @@
+#include "gray.h"
+
+//GRAY_NO_SIMD 只用C实现, tools/simd_ref.c 用它生成对比结果
+#if defined(GRAY_NO_SIMD)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GRAY_SIMD_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define GRAY_SIMD_SSE2 1
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define GRAY_SIMD_SSSE3 1
+#endif
+#endif
+
+/*
+ * 4级量化阈值, 与四舍五入 3 * (255 - g) / 255 一致:
+ * level = (g <= 42) + (g <= 127) + (g <= 212)
+ */
+#define GRAY_TH0 (42)
+#define GRAY_TH1 (127)
+#define GRAY_TH2 (212)
+
+static inline uint8_t gray_level(uint8_t g)
+{
+    return (uint8_t)((g <= GRAY_TH0) + (g <= GRAY_TH1) + (g <= GRAY_TH2));
+}
+
+static void gray_pack_page_c(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+                             int32_t x0, int32_t width, uint8_t *dst)
+{
+    int32_t x = 0;
+    uint8_t b = 0;
+
+    for (x = x0; x < width; x++)
+    {
+        b = (uint8_t)(gray_level(r0[x]) << 6);
+        b |= (r1 != NULL) ? (uint8_t)(gray_level(r1[x]) << 4) : 0;
+        b |= (r2 != NULL) ? (uint8_t)(gray_level(r2[x]) << 2) : 0;
+        b |= (r3 != NULL) ? gray_level(r3[x]) : 0;
+        dst[x] = b;
+    }
+}
+
+#if GRAY_SIMD_NEON
+static inline uint8x16_t gray_level_neon(uint8x16_t g)
+{
+    //比较结果为0xFF(-1), 相减即累加
+    uint8x16_t q = vdupq_n_u8(0);
+    q = vsubq_u8(q, vcleq_u8(g, vdupq_n_u8(GRAY_TH0)));
+    q = vsubq_u8(q, vcleq_u8(g, vdupq_n_u8(GRAY_TH1)));
+    q = vsubq_u8(q, vcleq_u8(g, vdupq_n_u8(GRAY_TH2)));
+    return q;
+}
+
+static int32_t gray_pack_page_simd(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+                                   int32_t width, uint8_t *dst)
+{
+    int32_t x = 0;
+    uint8x16_t b;
+
+    for (x = 0; x + 16 <= width; x += 16)
+    {
+        b = vshlq_n_u8(gray_level_neon(vld1q_u8(r0 + x)), 6);
+        b = vorrq_u8(b, vshlq_n_u8(gray_level_neon(vld1q_u8(r1 + x)), 4));
+        b = vorrq_u8(b, vshlq_n_u8(gray_level_neon(vld1q_u8(r2 + x)), 2));
+        b = vorrq_u8(b, gray_level_neon(vld1q_u8(r3 + x)));
+        vst1q_u8(dst + x, b);
+    }
+
+    return x;
+}
+#elif GRAY_SIMD_SSE2
+static inline __m128i gray_level_sse2(__m128i g)
+{
+    //g <= th  <=>  min(g, th) == g, 比较结果为0xFF(-1), 相减即累加
+    __m128i q = _mm_setzero_si128();
+    q = _mm_sub_epi8(q, _mm_cmpeq_epi8(_mm_min_epu8(g, _mm_set1_epi8(GRAY_TH0)), g));
+    q = _mm_sub_epi8(q, _mm_cmpeq_epi8(_mm_min_epu8(g, _mm_set1_epi8(GRAY_TH1)), g));
+    q = _mm_sub_epi8(q, _mm_cmpeq_epi8(_mm_min_epu8(g, _mm_set1_epi8((char)GRAY_TH2)), g));
+    return q;
+}
+
+static int32_t gray_pack_page_simd(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+                                   int32_t width, uint8_t *dst)
+{
+    int32_t x = 0;
+    __m128i b;
+
+    //level <= 3, 16bit移位不会越过字节边界
+    for (x = 0; x + 16 <= width; x += 16)
+    {
+        b = _mm_slli_epi16(gray_level_sse2(_mm_loadu_si128((const __m128i *)(r0 + x))), 6);
+        b = _mm_or_si128(b, _mm_slli_epi16(gray_level_sse2(_mm_loadu_si128((const __m128i *)(r1 + x))), 4));
+        b = _mm_or_si128(b, _mm_slli_epi16(gray_level_sse2(_mm_loadu_si128((const __m128i *)(r2 + x))), 2));
+        b = _mm_or_si128(b, gray_level_sse2(_mm_loadu_si128((const __m128i *)(r3 + x))));
+        _mm_storeu_si128((__m128i *)(dst + x), b);
+    }
+
+    return x;
+}
+#else
+static int32_t gray_pack_page_simd(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2, const uint8_t *r3,
+                                   int32_t width, uint8_t *dst)
+{
+    (void)r0;
+    (void)r1;
+    (void)r2;
+    (void)r3;
+    (void)width;
+    (void)dst;
+    return 0;
+}
+#endif
+
+void gray_pack_2bpp(const uint8_t *src, int32_t stride, int32_t width, int32_t height, uint8_t *dst)
+{
+    int32_t y = 0, x = 0;
+    const uint8_t *r0 = NULL, *r1 = NULL, *r2 = NULL, *r3 = NULL;
+
+    for (y = 0; y < height; y += GRAY_PAGE_ROW)
+    {
+        r0 = src + (size_t)y * stride;
+        r1 = ((y + 1) < height) ? (r0 + stride) : NULL;
+        r2 = ((y + 2) < height) ? (r0 + stride * 2) : NULL;
+        r3 = ((y + 3) < height) ? (r0 + stride * 3) : NULL;
+
+        //最后不满一页的行用白色(0)填充
+        x = (r3 != NULL) ? gray_pack_page_simd(r0, r1, r2, r3, width, dst) : 0;
+        gray_pack_page_c(r0, r1, r2, r3, x, width, dst);
+        dst += width;
+    }
+}
+
+void gray_lut_build(const uint8_t map[4], int32_t invert, gray_lut_t *lut)
+{
+    int32_t i = 0, r = 0;
+    uint8_t v = 0, b = 0;
+
+    for (i = 0; i < 256; i++)
+    {
+        v = (uint8_t)(invert ? ~i : i);
+        b = 0;
+        for (r = 0; r < GRAY_PAGE_ROW; r++)
+        {
+            b |= (uint8_t)((map[(v >> (r * GRAY_PIXEL_BIT)) & 0x03] & 0x03) << (r * GRAY_PIXEL_BIT));
+        }
+        lut->byte[i] = b;
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        lut->nib[i] = lut->byte[i] & 0x0F;
+    }
+}
+
+#if GRAY_SIMD_NEON
+static int32_t gray_lut_apply_simd(const gray_lut_t *lut, const uint8_t *src, uint8_t *dst, int32_t len)
+{
+    int32_t i = 0;
+    uint8x16_t v, lo, hi;
+#if defined(__aarch64__)
+    uint8x16_t tbl = vld1q_u8(lut->nib);
+#else
+    uint8x8x2_t tbl = {{vld1_u8(lut->nib), vld1_u8(lut->nib + 8)}};
+#endif
+
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        v = vld1q_u8(src + i);
+#if defined(__aarch64__)
+        lo = vqtbl1q_u8(tbl, vandq_u8(v, vdupq_n_u8(0x0F)));
+        hi = vqtbl1q_u8(tbl, vshrq_n_u8(v, 4));
+#else
+        //ARMv7 没有16字节查表, 用 vtbl2 查两次8字节
+        lo = vandq_u8(v, vdupq_n_u8(0x0F));
+        hi = vshrq_n_u8(v, 4);
+        lo = vcombine_u8(vtbl2_u8(tbl, vget_low_u8(lo)), vtbl2_u8(tbl, vget_high_u8(lo)));
+        hi = vcombine_u8(vtbl2_u8(tbl, vget_low_u8(hi)), vtbl2_u8(tbl, vget_high_u8(hi)));
+#endif
+        vst1q_u8(dst + i, vorrq_u8(lo, vshlq_n_u8(hi, 4)));
+    }
+
+    return i;
+}
+#elif GRAY_SIMD_SSSE3
+static int32_t gray_lut_apply_simd(const gray_lut_t *lut, const uint8_t *src, uint8_t *dst, int32_t len)
+{
+    int32_t i = 0;
+    const __m128i tbl = _mm_loadu_si128((const __m128i *)lut->nib);
+    const __m128i msk = _mm_set1_epi8(0x0F);
+    __m128i v, lo, hi;
+
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        v = _mm_loadu_si128((const __m128i *)(src + i));
+        lo = _mm_shuffle_epi8(tbl, _mm_and_si128(v, msk));
+        hi = _mm_shuffle_epi8(tbl, _mm_and_si128(_mm_srli_epi16(v, 4), msk));
+        //查表结果不超过0x0F, 16bit左移不会越过字节边界
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(lo, _mm_slli_epi16(hi, 4)));
+    }
+
+    return i;
+}
+#else
+static int32_t gray_lut_apply_simd(const gray_lut_t *lut, const uint8_t *src, uint8_t *dst, int32_t len)
+{
+    (void)lut;
+    (void)src;
+    (void)dst;
+    (void)len;
+    return 0;
+}
+#endif
+
+void gray_lut_apply(const gray_lut_t *lut, const uint8_t *src, uint8_t *dst, int32_t len)
+{
+    int32_t i = 0;
+
+    for (i = gray_lut_apply_simd(lut, src, dst, len); i < len; i++)
+    {
+        dst[i] = lut->byte[src[i]];
+    }
+}
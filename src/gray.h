@@ -0,0 +1,54 @@
+#ifndef _LCD_GRAY_H_
+#define _LCD_GRAY_H_
+
+#include "type.h"
+
+#define GRAY_PIXEL_BIT (2)
+#define GRAY_PAGE_ROW (8 / GRAY_PIXEL_BIT)
+#define GRAY_FRAME_LEN(w, h) ((((h) + GRAY_PAGE_ROW - 1) / GRAY_PAGE_ROW) * (w))
+
+/*****************************************************************************
+函 数 名  : gray_pack_2bpp
+功能描述  : 把8bit灰度图量化为4级灰度, 并按屏幕的页格式打包
+            (每字节竖排4个像素, 上方像素在高位, 白色为0, 黑色为3)
+输入参数  : src     8bit灰度图
+            stride  src每行的字节数
+            width   图像宽度
+            height  图像高度
+输出参数  : dst     打包后的数据, 每页width字节, 共GRAY_FRAME_LEN(width, height)字节
+返 回 值  : 无
+*****************************************************************************/
+extern void gray_pack_2bpp(const uint8_t *src, int32_t stride, int32_t width, int32_t height, uint8_t *dst);
+
+/*
+ * 已打包的2bpp数据的灰度重映射表. 每个像素独立映射, 所以一个字节的
+ * 映射可以拆成高低两个半字节(各2个像素)分别查16项的表, 便于SIMD查表.
+ */
+typedef struct gray_lut_s
+{
+    uint8_t byte[256]; //整字节查表
+    uint8_t nib[16];   //半字节查表, byte[(h << 4) | l] == (nib[h] << 4) | nib[l]
+} gray_lut_t;
+
+/*****************************************************************************
+函 数 名  : gray_lut_build
+功能描述  : 由4个灰度级的映射生成查找表
+输入参数  : map     map[level] 为 level(0白-3黑) 映射后的灰度级
+            invert  1-映射前先反色(~dat)
+输出参数  : lut     查找表
+返 回 值  : 无
+*****************************************************************************/
+extern void gray_lut_build(const uint8_t map[4], int32_t invert, gray_lut_t *lut);
+
+/*****************************************************************************
+函 数 名  : gray_lut_apply
+功能描述  : 用查找表重映射 len 个字节(每字节4个像素), src 和 dst 可以相同
+输入参数  : lut  查找表
+            src  源数据
+            len  字节数
+输出参数  : dst  结果
+返 回 值  : 无
+*****************************************************************************/
+extern void gray_lut_apply(const gray_lut_t *lut, const uint8_t *src, uint8_t *dst, int32_t len);
+
+#endif
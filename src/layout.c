@@ -0,0 +1,259 @@
+#include "layout.h"
+#include "lcd.h"
+
+#define LAYOUT_IS_BREAK(c) (((c) == ' ') || ((c) == '\r') || ((c) == '\n'))
+
+/*
+ * layout_row:
+ *	从 text[p] 开始排第 r 行, 返回下一行第一个字符的位置.
+ *	一行的排法只取决于 text[p] 之后的内容.
+ */
+static int32_t layout_row(lcd_layout_t *lo, int32_t r, int32_t p)
+{
+    int8_t *cell = lo->cell[r];
+    int32_t col = 0, n = 0;
+    int8_t c = 0;
+
+    memset(cell, ' ', LAYOUT_COL_MAX);
+    while (p < lo->len)
+    {
+        c = lo->text[p];
+        if (c == '\n')
+        {
+            return p + 1;
+        }
+
+        if (c == '\r')
+        {
+            //text[len] 为 '\0', 不会越界
+            if (lo->text[p + 1] == '\n')
+            {
+                return p + 2;
+            }
+            col = 0;
+            p++;
+            continue;
+        }
+
+        if (col >= lo->cols)
+        {
+            //折行处的空格不显示
+            return (c == ' ') ? (p + 1) : p;
+        }
+
+        if ((lo->wrap == LAYOUT_WRAP_WORD) && (c != ' ') && (col > 0) && (lo->text[p - 1] == ' '))
+        {
+            for (n = 0; ((p + n) < lo->len) && !LAYOUT_IS_BREAK(lo->text[p + n]); n++);
+            if (((col + n) > lo->cols) && (n <= lo->cols))
+            {
+                return p;
+            }
+        }
+
+        cell[col++] = c;
+        p++;
+    }
+
+    return p;
+}
+
+/*
+ * layout_flow:
+ *	text 中 [0, from) 与原文字相同, [tail, len) 与原文字 [tail - delta, len - delta)
+ *	相同. 从改动所在的行开始重排, 某一行的起点落在 tail 之后并且与原来的
+ *	行起点对齐时, 后面的行与原来完全一样, 只修正行起点.
+ */
+static void layout_flow(lcd_layout_t *lo, int32_t from, int32_t tail, int32_t delta)
+{
+    int32_t old_start[LAYOUT_ROW_MAX + 1];
+    int32_t old_used = lo->used;
+    int32_t r = 0, p = 0, k = 0;
+
+    memcpy(old_start, lo->row_start, sizeof(old_start));
+
+    if (lo->wrap == LAYOUT_WRAP_WORD)
+    {
+        //单词是否移到下一行在排到单词开头时决定
+        while ((from > 0) && !LAYOUT_IS_BREAK(lo->text[from - 1]))
+        {
+            from--;
+        }
+    }
+
+    //行尾是否折行还要看下一行的第一个字符, 改动恰好在行首时从上一行开始
+    for (r = 0; ((r + 1) < old_used) && (old_start[r + 1] < from); r++);
+
+    p = old_start[r];
+    while ((r < lo->rows) && (p < lo->len))
+    {
+        if ((r < old_used) && (p >= tail) && ((old_start[r] + delta) == p))
+        {
+            for (k = r; k <= old_used; k++)
+            {
+                lo->row_start[k] = old_start[k] + delta;
+            }
+            return;
+        }
+
+        lo->row_start[r] = p;
+        p = layout_row(lo, r, p);
+        r++;
+    }
+
+    lo->row_start[r] = p;
+    lo->used = r;
+    for (; r < old_used; r++)
+    {
+        memset(lo->cell[r], ' ', LAYOUT_COL_MAX);
+    }
+}
+
+/*
+ * layout_draw:
+ *	只画与 shown 不同的格子. 调用者持有 lcd_lock 并已切换到排版的字体.
+ */
+static void layout_draw(lcd_layout_t *lo)
+{
+    font_t *pfont = lcd_get_font();
+    int32_t r = 0, c = 0;
+
+    for (r = 0; r < lo->rows; r++)
+    {
+        if (lo->valid && (memcmp(lo->cell[r], lo->shown[r], lo->cols) == 0))
+        {
+            continue;
+        }
+
+        for (c = 0; c < lo->cols; c++)
+        {
+            if (lo->valid && (lo->cell[r][c] == lo->shown[r][c]))
+            {
+                continue;
+            }
+            lcd_putc_s(lo->x0 + c * pfont->width, lo->x0, lo->x1, lo->y0 + r * pfont->height,
+                       lo->cell[r][c], lo->bcolor, lo->fcolor);
+        }
+        memcpy(lo->shown[r], lo->cell[r], LAYOUT_COL_MAX);
+    }
+
+    lo->valid = 1;
+}
+
+static void layout_update(lcd_layout_t *lo, int32_t from, int32_t tail, int32_t delta)
+{
+    font_t *pfont = NULL;
+
+    lcd_lock();
+    pfont = lcd_get_font();
+    lcd_set_font(lo->font);
+    if (from >= 0)
+    {
+        layout_flow(lo, from, tail, delta);
+    }
+    layout_draw(lo);
+    lcd_set_font(pfont->name);
+    lcd_unlock();
+}
+
+lcd_layout_t *layout_create(int32_t x0, int32_t x1, int32_t y0, int32_t y1, int32_t bcolor, int32_t fcolor, int32_t wrap)
+{
+    lcd_layout_t *lo = NULL;
+    font_t *pfont = lcd_get_font();
+    int32_t right = (x1 > LCD_MAX_X) ? LCD_MAX_X : x1;
+    int32_t bottom = (y1 > (LCD_MAX_Y - 1)) ? (LCD_MAX_Y - 1) : y1;
+
+    if ((x0 < 0) || (x0 >= right) || (y0 < 0) || ((bottom - y0 + 1) < pfont->height))
+    {
+        DEBUG_LOG("layout box invalid");
+        return NULL;
+    }
+
+    lo = (lcd_layout_t *)calloc(1, sizeof(lcd_layout_t));
+    if (lo == NULL)
+    {
+        DEBUG_ERR(ERROR, "layout malloc failed");
+        return NULL;
+    }
+
+    lo->x0 = x0;
+    lo->x1 = x1;
+    lo->y0 = y0;
+    lo->font = pfont->name;
+    lo->bcolor = bcolor;
+    lo->fcolor = fcolor;
+    lo->wrap = wrap;
+
+    //字符的起点小于 x1 并且在屏幕内时放在这一行
+    lo->cols = (right - x0 + pfont->width - 1) / pfont->width;
+    lo->cols = (lo->cols > LAYOUT_COL_MAX) ? LAYOUT_COL_MAX : lo->cols;
+    lo->rows = (bottom - y0 + 1) / pfont->height;
+    lo->rows = (lo->rows > LAYOUT_ROW_MAX) ? LAYOUT_ROW_MAX : lo->rows;
+    memset(lo->cell, ' ', sizeof(lo->cell));
+
+    return lo;
+}
+
+int32_t layout_destroy(lcd_layout_t *lo)
+{
+    if (lo == NULL)
+    {
+        return ERROR;
+    }
+
+    free(lo);
+    return OK;
+}
+
+int32_t layout_set_text(lcd_layout_t *lo, int8_t *str)
+{
+    int32_t len = 0, pre = 0, suf = 0;
+    int32_t delta = 0;
+
+    if ((lo == NULL) || (str == NULL))
+    {
+        return ERROR;
+    }
+
+    len = (int32_t)strnlen((char *)str, LAYOUT_TEXT_LEN);
+    for (pre = 0; (pre < len) && (pre < lo->len) && (str[pre] == lo->text[pre]); pre++);
+    for (suf = 0; (suf < (len - pre)) && (suf < (lo->len - pre)) && (str[len - 1 - suf] == lo->text[lo->len - 1 - suf]); suf++);
+
+    delta = len - lo->len;
+    memmove(lo->text + pre, str + pre, len - pre);
+    lo->text[len] = '\0';
+    lo->len = len;
+
+    layout_update(lo, pre, len - suf, delta);
+    return OK;
+}
+
+int32_t layout_append(lcd_layout_t *lo, int8_t *str)
+{
+    int32_t n = 0, from = 0;
+
+    if ((lo == NULL) || (str == NULL))
+    {
+        return ERROR;
+    }
+
+    from = lo->len;
+    n = (int32_t)strnlen((char *)str, LAYOUT_TEXT_LEN - lo->len);
+    memcpy(lo->text + lo->len, str, n);
+    lo->len += n;
+    lo->text[lo->len] = '\0';
+
+    layout_update(lo, from, lo->len, n);
+    return OK;
+}
+
+int32_t layout_redraw(lcd_layout_t *lo)
+{
+    if (lo == NULL)
+    {
+        return ERROR;
+    }
+
+    lo->valid = 0;
+    layout_update(lo, ERROR, 0, 0);
+    return OK;
+}
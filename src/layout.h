@@ -0,0 +1,86 @@
+#ifndef _LCD_LAYOUT_H_
+#define _LCD_LAYOUT_H_
+
+#include "type.h"
+
+#define LAYOUT_TEXT_LEN (1023)
+#define LAYOUT_ROW_MAX (14) //最小字体 5x7 时一屏的行数
+#define LAYOUT_COL_MAX (40) //最小字体 5x7 时一行的字数
+
+typedef enum lcd_layout_wrap_e
+{
+    LAYOUT_WRAP_CHAR = 0, //到行尾就折行, 与 lcd_text_s 相同
+    LAYOUT_WRAP_WORD,     //放不下的单词整个移到下一行, 比一行还长的单词按字符折行
+} lcd_layout_wrap_t;
+
+/*
+ * 排版结果按格子保存: 第 r 行第 c 个字符画在 (x0 + c * width, y0 + r * height),
+ * 空格子为空格. shown 是上一次画到显存里的格子, 重画时只画两者不同的格子.
+ */
+typedef struct lcd_layout_s
+{
+    int32_t x0;           //可视区域的起止列(包含), 字符的起点小于 x1 时放在这一行
+    int32_t x1;
+    int32_t y0;
+    int32_t font;         //创建时的字体
+    int32_t bcolor;
+    int32_t fcolor;
+    int32_t wrap;
+    int32_t cols;         //每行的格子数
+    int32_t rows;         //区域内完整的行数
+    int32_t used;         //排了字的行数
+    int32_t len;
+    int8_t text[LAYOUT_TEXT_LEN + 1];
+    int32_t row_start[LAYOUT_ROW_MAX + 1]; //每行第一个字符在 text 中的位置, row_start[used] 为排到的位置
+    int8_t cell[LAYOUT_ROW_MAX][LAYOUT_COL_MAX];
+    int8_t shown[LAYOUT_ROW_MAX][LAYOUT_COL_MAX];
+    int32_t valid;        //shown 是否与显存一致
+} lcd_layout_t;
+
+/*****************************************************************************
+函 数 名  : layout_create
+功能描述  : 创建一个文字排版对象, 使用当前字体. 文字按 lcd_text_s 的规则折行,
+            '\n' 和 "\r\n" 换到下一行行首, 单独的 '\r' 回到本行行首.
+            超出区域的文字不显示
+输入参数  : x0, x1          可视区域的起止列(包含)
+            y0, y1          可视区域的起止行(包含), 只使用完整的行
+            bcolor, fcolor  背景色和前景色
+            wrap            折行方式, lcd_layout_wrap_t
+输出参数  : 无
+返 回 值  : 排版对象, 失败返回NULL
+*****************************************************************************/
+extern lcd_layout_t *layout_create(int32_t x0, int32_t x1, int32_t y0, int32_t y1, int32_t bcolor, int32_t fcolor, int32_t wrap);
+extern int32_t layout_destroy(lcd_layout_t *lo);
+
+/*****************************************************************************
+函 数 名  : layout_set_text
+功能描述  : 更换文字并写入显存(不更新硬件). 与原文字相同的开头和结尾部分
+            不再排版: 从第一个改动所在的行开始重排, 排到与原来对齐的行就停止;
+            只画内容变化的格子
+输入参数  : lo   排版对象
+            str  文字, 超过 LAYOUT_TEXT_LEN 的部分截断
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t layout_set_text(lcd_layout_t *lo, int8_t *str);
+
+/*****************************************************************************
+函 数 名  : layout_append
+功能描述  : 在文字末尾追加, 只重排和重画最后一行之后的内容, 用于日志窗口
+输入参数  : lo   排版对象
+            str  追加的文字
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t layout_append(lcd_layout_t *lo, int8_t *str);
+
+/*****************************************************************************
+函 数 名  : layout_redraw
+功能描述  : 整个区域重画一次, 用于显存被其它内容覆盖之后
+输入参数  : lo  排版对象
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t layout_redraw(lcd_layout_t *lo);
+
+#endif
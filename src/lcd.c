@@ -1,4 +1,6 @@
 #include "lcd.h"
+#include "strip.h"
+#include <pthread.h>
 
 #define _memset_ memset
 #define _memcpy_ memcpy
@@ -20,11 +22,31 @@ static int32_t LCD_DISP_COLOUR[LCD_COL_MAX] =
 
 font_t *LCD_DISP_FONT = NULL;
 
+static pthread_mutex_t LCD_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+//灰度级重映射, LCD_LEVEL_LUT[0]为反色用的表; 恒等映射时不查表
+static uint8_t LCD_LEVEL_MAP[LCD_COL_MAX] = {0, 1, 2, 3};
+static gray_lut_t LCD_LEVEL_LUT[2];
+static int32_t LCD_LEVEL_IDENTITY = 1;
+
+//放大字符用: 一个字节(一列中的8行)的每一位重复 scale 次, 低位为上面的行
+static uint32_t LCD_SCALE_SPREAD[LCD_SCALE_MAX + 1][256];
+
 void delay_xms(uint32_t ms)
 {
     delay(ms);
 }
 
+void lcd_lock(void)
+{
+    pthread_mutex_lock(&LCD_LOCK);
+}
+
+void lcd_unlock(void)
+{
+    pthread_mutex_unlock(&LCD_LOCK);
+}
+
 /*****************************************************************************
 函 数 名  : led_set_mirror
 功能描述  : 设置屏幕镜像显示
@@ -57,6 +79,34 @@ void lcd_set_mirror(uint8_t mirror)
     }
 }
 
+/*
+* lcd_scale_init:
+*	Build LCD_SCALE_SPREAD: every bit of a byte repeated s times, for
+*	lcd_putc_scale.
+*********************************************************************************
+*/
+static void lcd_scale_init(void)
+{
+    int32_t s = 0, v = 0, b = 0, k = 0;
+    uint32_t m = 0;
+
+    for (s = 1; s <= LCD_SCALE_MAX; s++)
+    {
+        for (v = 0; v < 256; v++)
+        {
+            m = 0;
+            for (b = 0; b < 8; b++)
+            {
+                for (k = 0; (v & (1 << b)) && (k < s); k++)
+                {
+                    m |= (uint32_t)1 << (b * s + k);
+                }
+            }
+            LCD_SCALE_SPREAD[s][v] = m;
+        }
+    }
+}
+
 /*****************************************************************************
 函 数 名  : led_init
 功能描述  : max7219初始化
@@ -66,6 +116,7 @@ void lcd_set_mirror(uint8_t mirror)
 *****************************************************************************/
 void lcd_init(void)
 {
+    lcd_scale_init();
     lcd_set_mirror(0);
     lcd_set_font(LCD_DEFAULT_FONT);
     lcd_drv_init();
@@ -130,6 +181,72 @@ void lcd_update(void)
     lcd_drv_update();
 }
 
+/*****************************************************************************
+函 数 名  : lcd_set_level_map
+功能描述  : 设置灰度级重映射, 之后的视频帧(lcd_blitbmp)和 lcd_putbmp 都按此映射
+输入参数  : map  map[level] 为 level(0白-3黑) 显示时使用的灰度级, NULL 为恒等映射
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+int32_t lcd_set_level_map(const uint8_t *map)
+{
+    static const uint8_t identity[LCD_COL_MAX] = {0, 1, 2, 3};
+    int32_t i = 0;
+
+    map = (map != NULL) ? map : identity;
+    for (i = 0; i < LCD_COL_MAX; i++)
+    {
+        if (map[i] >= LCD_COL_MAX)
+        {
+            return ERROR;
+        }
+    }
+
+    lcd_lock();
+    memcpy(LCD_LEVEL_MAP, map, sizeof(LCD_LEVEL_MAP));
+    gray_lut_build(LCD_LEVEL_MAP, 1, &LCD_LEVEL_LUT[0]);
+    gray_lut_build(LCD_LEVEL_MAP, 0, &LCD_LEVEL_LUT[1]);
+    LCD_LEVEL_IDENTITY = (memcmp(LCD_LEVEL_MAP, identity, sizeof(identity)) == 0);
+    lcd_unlock();
+
+    return OK;
+}
+
+/*****************************************************************************
+函 数 名  : lcd_flush
+功能描述  : 只把显存中修改过的页(列范围)写入硬件
+输入参数  : void
+输出参数  : 无
+返 回 值  : 无
+*****************************************************************************/
+void lcd_flush(void)
+{
+    lcd_drv_flush();
+}
+
+/*****************************************************************************
+函 数 名  : lcd_set_depth
+功能描述  : 设置屏幕显示模式, 2-4级灰度, 1-单色
+输入参数  : bits  每像素位数
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+int32_t lcd_set_depth(int32_t bits)
+{
+    if ((bits != 1) && (bits != LCD_DRV_COLOUR_BIT))
+    {
+        return ERROR;
+    }
+
+    lcd_drv_set_depth(bits);
+    return OK;
+}
+
+int32_t lcd_get_depth(void)
+{
+    return lcd_drv_get_depth();
+}
+
 /*****************************************************************************
 函 数 名  : led_clear
 功能描述  : 用制定颜色填充(刷新)显存
@@ -391,9 +508,7 @@ int32 fcolor    前景色
 *****************************************************************************/
 int32_t lcd_putc_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t chr, int32_t bcolor, int32_t fcolor)
 {
-    int32_t idx = 0;
-    uint8_t *dat = NULL;
-    int32_t fontwbyte = 0; //点阵字体数据每行所占的字节数
+    int32_t idx = 0, j = 0;
     font_t *pfont = lcd_get_font();
 
     if ((x_pos >= LCD_MAX_X) || (x_pos <= 0 - (pfont->width)) || (y_pos >= LCD_MAX_Y) || (y_pos <= 0 - (pfont->height)))
@@ -408,13 +523,151 @@ int32_t lcd_putc_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_po
 
     idx = _check_invalid_char_(chr);
 
-    //计算点阵字体数据每行所占的字节数
-    fontwbyte = ((pfont->width) % 8) ? ((pfont->width) / 8 + 1) : ((pfont->width) / 8);
+    //逐行取点阵, 压缩字库的行直接指向行表, 不需要解码缓冲
+    for (j = 0; j < pfont->height; j++)
+    {
+        lcd_blk_cpy2mem_b((uint8_t *)font_glyph_row(pfont, idx, j), x_pos, y_pos + j, x_disp0, x_disp1, pfont->width, 1, bcolor, fcolor);
+    }
 
-    //计算指定字符的点阵数据指针(偏移)
-    dat = (uint8_t *)((pfont->pdata) + (idx * fontwbyte * (pfont->height)));
+    return OK;
+}
+
+/*****************************************************************************
+函 数 名  : lcd_putc_scale
+功能描述  : 把当前字体的字符放大 scale 倍写入显存. 先把点阵转成按列的位图
+            (低位为上面的行), 每列查表展开成 scale 倍高度, 再按4行一组查表
+            得到页格式字节, 复制 scale 列后用 lcd_drv_blit_strip 按字节写入
+输入参数  : 见 lcd.h
+输出参数  : 无
+返 回 值  : 0-成功,1-失败
+*****************************************************************************/
+int32_t lcd_putc_scale(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t chr, int32_t scale, int32_t bcolor, int32_t fcolor)
+{
+    //最大字体放大 LCD_SCALE_MAX 倍, 加上页内偏移多出的一页
+    uint8_t strip[((FONT_HEIGHT_MAX * LCD_SCALE_MAX) / LCD_DRV_PAGE_ROW + 2) * FONT_WIDTH_MAX * LCD_SCALE_MAX];
+    uint32_t col[FONT_WIDTH_MAX], bits[4], v = 0;
+    uint8_t nib[16];
+    const uint8_t *dat = NULL;
+    int32_t idx = 0, width = 0, height = 0, phase = 0, pages = 0;
+    int32_t c0 = 0, c1 = 0, b = 0, j = 0, k = 0, off = 0;
+    uint8_t *dst = NULL;
+    font_t *pfont = lcd_get_font();
+
+    if ((scale < 1) || (scale > LCD_SCALE_MAX) || (x_disp1 < x_disp0) ||
+        (pfont->width > FONT_WIDTH_MAX) || (pfont->height > FONT_HEIGHT_MAX))
+    {
+        return ERROR;
+    }
+
+    width = pfont->width * scale;
+    height = pfont->height * scale;
+    if ((x_pos >= LCD_MAX_X) || (x_pos <= 0 - width) || (y_pos >= LCD_MAX_Y) || (y_pos <= 0 - height))
+    {
+        return ERROR;
+    }
+
+    c0 = (x_disp0 > x_pos) ? x_disp0 : x_pos;
+    c0 = (c0 < 0) ? 0 : c0;
+    c1 = (x_disp1 < (x_pos + width - 1)) ? x_disp1 : (x_pos + width - 1);
+    c1 = (c1 > (LCD_MAX_X - 1)) ? (LCD_MAX_X - 1) : c1;
+    if (c0 > c1)
+    {
+        return OK;
+    }
+
+    //4行的前景/背景组合对应的页格式字节, 第0位为页内最上面的行
+    for (k = 0; k < 16; k++)
+    {
+        nib[k] = 0;
+        for (j = 0; j < LCD_DRV_PAGE_ROW; j++)
+        {
+            v = (uint32_t)((((k >> j) & 1) ? fcolor : bcolor) & LCD_DRV_COLOUR_BIT_MSK);
+            nib[k] |= (uint8_t)(v << ((LCD_DRV_PAGE_ROW - j - 1) * LCD_DRV_COLOUR_BIT));
+        }
+    }
+
+    //点阵每行高位在左, 转成每列一个位图
+    idx = _check_invalid_char_(chr);
+    memset(col, 0, sizeof(col));
+    for (j = 0; j < pfont->height; j++)
+    {
+        dat = font_glyph_row(pfont, idx, j);
+        for (b = 0; b < pfont->width; b++)
+        {
+            if (dat[b / 8] & (0x80 >> (b % 8)))
+            {
+                col[b] |= (uint32_t)1 << j;
+            }
+        }
+    }
+
+    phase = ((y_pos % LCD_DRV_PAGE_ROW) + LCD_DRV_PAGE_ROW) % LCD_DRV_PAGE_ROW;
+    pages = (phase + height + LCD_DRV_PAGE_ROW - 1) / LCD_DRV_PAGE_ROW;
+    for (b = (c0 - x_pos) / scale; b <= (c1 - x_pos) / scale; b++)
+    {
+        //第 r 行放在 bits 的第 phase + r 位
+        memset(bits, 0, sizeof(bits));
+        for (j = 0; j < pfont->height; j += 8)
+        {
+            v = LCD_SCALE_SPREAD[scale][(col[b] >> j) & 0xFF];
+            off = phase + j * scale;
+            bits[off / 32] |= v << (off % 32);
+            if ((off % 32) && (((off % 32) + 8 * scale) > 32))
+            {
+                bits[off / 32 + 1] |= v >> (32 - (off % 32));
+            }
+        }
+
+        for (k = 0; k < pages; k++)
+        {
+            dst = strip + k * width + b * scale;
+            memset(dst, nib[(bits[k / 8] >> ((k % 8) * 4)) & 0x0F], scale);
+        }
+    }
+
+    lcd_drv_blit_strip(c0, y_pos, c1 - c0 + 1, height, strip, width, c0 - x_pos);
+    return OK;
+}
+
+/*****************************************************************************
+函 数 名  : lcd_puts_scale
+功能描述  : 与 lcd_puts_clip 相同, 字符放大 scale 倍
+输入参数  : 见 lcd.h
+输出参数  : 无
+返 回 值  : 0-成功,1-失败
+*****************************************************************************/
+int32_t lcd_puts_scale(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t scale, int32_t bcolor, int32_t fcolor)
+{
+    int32_t i = 0, first = 0, last = 0;
+    int32_t xpos = 0, c0 = 0, c1 = 0, width = 0;
+    font_t *pfont = lcd_get_font();
+
+    if ((str == NULL) || (scale < 1) || (scale > LCD_SCALE_MAX) || (y_pos <= 0 - (pfont->height * scale)) ||
+        (y_pos >= LCD_MAX_Y) || (x_disp1 < x_disp0))
+    {
+        return ERROR;
+    }
+
+    c0 = (x_disp0 < 0) ? 0 : x_disp0;
+    c1 = (x_disp1 > (LCD_MAX_X - 1)) ? (LCD_MAX_X - 1) : x_disp1;
+    if ((c0 > c1) || (c1 < x_pos))
+    {
+        return OK;
+    }
 
-    return lcd_blk_cpy2mem_s(dat, x_pos, x_disp0, x_disp1, y_pos, bcolor, fcolor);
+    width = pfont->width * scale;
+    first = (c0 > x_pos) ? ((c0 - x_pos) / width) : 0;
+    last = (c1 - x_pos) / width;
+    last = (int32_t)strnlen((char *)str, last + 1) - 1;
+
+    xpos = x_pos + first * width;
+    for (i = first; i <= last; i++)
+    {
+        lcd_putc_scale(xpos, c0, c1, y_pos, str[i], scale, bcolor, fcolor);
+        xpos += width;
+    }
+
+    return OK;
 }
 
 /*****************************************************************************
@@ -462,23 +715,18 @@ int32_t lcd_puts(int32_t x_pos, int32_t y_pos, int8_t *str, int32_t bcolor, int3
 #endif
 
 /*****************************************************************************
-函 数 名  : led_puts_s
-功能描述  : 显示一个字符串图像(只写入显存,不更新硬件)
-输入参数  :
-int32 x_pos     要显示的字符图像的x坐标
-int32 x_disp0   指定可视部分起始位置
-int32 x_disp1   指定可视部分结束位置
-int32 y_pos     要显示的字符串的y坐标
-char *str       需要显示的字符串
-int32 bcolor    背景色
-int32 fcolor    前景色
+函 数 名  : lcd_puts_clip
+功能描述  : 逐字显示字符串的可视部分(只写入显存,不更新硬件). 第一个和最后一个
+            可见字符只算一次, 中间的字符整字画, 首尾两个字符按列裁剪;
+            字符串只检查到最后一个可见字符, 不用 strlen 走完整串
+输入参数  : 同 lcd_puts_s
 输出参数  : 无
 返 回 值  : 0-成功,1-失败
 *****************************************************************************/
-int32_t lcd_puts_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor)
+int32_t lcd_puts_clip(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor)
 {
-    int32_t xpos = x_pos, i = 0, slen = 0;
-    int32_t xdisp0 = 0, xdisp1 = 0;
+    int32_t i = 0, first = 0, last = 0;
+    int32_t xpos = 0, c0 = 0, c1 = 0;
     font_t *pfont = lcd_get_font();
 
     if ((str == NULL) || (y_pos <= 0 - (pfont->height)) || (y_pos >= LCD_MAX_Y) || (x_disp1 < x_disp0))
@@ -486,45 +734,55 @@ int32_t lcd_puts_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_po
         return ERROR;
     }
 
-    slen = _strlen_(str);
+    //可视列 [c0, c1] 与屏幕的交集
+    c0 = (x_disp0 < 0) ? 0 : x_disp0;
+    c1 = (x_disp1 > (LCD_MAX_X - 1)) ? (LCD_MAX_X - 1) : x_disp1;
+    if ((c0 > c1) || (c1 < x_pos))
+    {
+        return OK;
+    }
 
-    xdisp0 = x_disp0 - x_pos;
-    xdisp1 = x_disp1 - x_pos;
+    first = (c0 > x_pos) ? ((c0 - x_pos) / (pfont->width)) : 0;
+    last = (c1 - x_pos) / (pfont->width);
+    last = (int32_t)strnlen((char *)str, last + 1) - 1;
 
-    for (i = 0; i < slen; i++)
+    xpos = x_pos + first * (pfont->width);
+    for (i = first; i <= last; i++)
     {
-        if (i < (xdisp0 / (pfont->width)))
-        {
-            xpos += (pfont->width);
-            continue;
-        }
-        if (i == (xdisp0 / (pfont->width)))
-        {
-            lcd_putc_s(xpos, x_disp0, xpos + pfont->width, y_pos, str[i], bcolor, fcolor);
-            xpos += (pfont->width);
-            continue;
-        }
-        if (i == (xdisp1 / (pfont->width)))
-        {
-            lcd_putc_s(xpos, xpos, x_disp1, y_pos, str[i], bcolor, fcolor);
-            xpos += (pfont->width);
-            continue;
-        }
-        if (i > (xdisp1 / (pfont->width)))
-        {
-            break;
-        }
-        if ((xpos >= LCD_MAX_X) || (xpos > x_disp1))
-        {
-            break;
-        }
-        lcd_putc(xpos, y_pos, str[i], bcolor, fcolor);
+        lcd_putc_s(xpos, (i == first) ? c0 : xpos, (i == last) ? c1 : (xpos + pfont->width - 1), y_pos, str[i], bcolor, fcolor);
         xpos += (pfont->width);
     }
 
     return OK;
 }
 
+/*****************************************************************************
+函 数 名  : led_puts_s
+功能描述  : 显示一个字符串图像(只写入显存,不更新硬件)
+输入参数  :
+int32 x_pos     要显示的字符图像的x坐标
+int32 x_disp0   指定可视部分起始位置
+int32 x_disp1   指定可视部分结束位置
+int32 y_pos     要显示的字符串的y坐标
+char *str       需要显示的字符串
+int32 bcolor    背景色
+int32 fcolor    前景色
+输出参数  : 无
+返 回 值  : 0-成功,1-失败
+*****************************************************************************/
+#if LCD_STRIP_CACHE
+int32_t lcd_puts_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor)
+{
+    //滚动时同一字符串只渲染一次, 之后按窗口拷贝
+    return strip_puts_s(x_pos, x_disp0, x_disp1, y_pos, str, bcolor, fcolor);
+}
+#else
+int32_t lcd_puts_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor)
+{
+    return lcd_puts_clip(x_pos, x_disp0, x_disp1, y_pos, str, bcolor, fcolor);
+}
+#endif
+
 /*****************************************************************************
 函 数 名  : led_scroll_puts
 功能描述  : 滚动显示一个字符串图像(只写入显存,不更新硬件)
@@ -565,7 +823,7 @@ int32_t lcd_scroll_puts(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t
                 break;
             }
             lcd_puts_s(i, x_disp0, x_disp1, y_pos, str, bcolor, fcolor);
-            lcd_update();
+            lcd_flush();
             lcd_puts_s(i, x_disp0, x_disp1, y_pos, str, bcolor, bcolor);
             if (delay)
                 delay_xms(delay);
@@ -580,7 +838,7 @@ int32_t lcd_scroll_puts(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t
                 break;
             }
             lcd_puts_s(i, x_disp0, x_disp1, y_pos, str, bcolor, fcolor);
-            lcd_update();
+            lcd_flush();
             lcd_puts_s(i, x_disp0, x_disp1, y_pos, str, bcolor, bcolor);
             if (delay)
                 delay_xms(delay);
@@ -632,6 +890,64 @@ int32_t lcd_scroll_puts_s(int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_
     return OK;
 }
 
+/*****************************************************************************
+函 数 名  : lcd_scroll_view
+功能描述  : 整屏垂直滚动, 只发送新露出的行
+输入参数  : int32 dy  滚动的行数, 正数内容上移
+输出参数  : 无
+返 回 值  : 无
+*****************************************************************************/
+void lcd_scroll_view(int32_t dy)
+{
+    lcd_drv_scroll(dy);
+}
+
+/*****************************************************************************
+函 数 名  : lcd_hshift
+功能描述  : 把显存中一个矩形区域内的图像水平移动 dx 列
+输入参数  : int32 x0, y0          区域左上角
+            int32 width, height   区域大小
+            int32 dx              移动的列数, 负数向左
+输出参数  : 无
+返 回 值  : 无
+*****************************************************************************/
+void lcd_hshift(int32_t x0, int32_t y0, int32_t width, int32_t height, int32_t dx)
+{
+    lcd_drv_hshift(x0, y0, width, height, dx);
+}
+
+/*****************************************************************************
+函 数 名  : lcd_log_puts
+功能描述  : 日志视图, 上移一行后在最底下一行显示字符串
+输入参数  : char *str       要显示的字符串
+int32 bcolor    背景色
+int32 fcolor    前景色
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+int32_t lcd_log_puts(int8_t *str, int32_t bcolor, int32_t fcolor)
+{
+    font_t *pfont = lcd_get_font();
+    int32_t line = 0;
+
+    if (str == NULL)
+    {
+        return ERROR;
+    }
+
+    //行高取整到页, 滚动只能按页进行
+    line = ((pfont->height + LCD_DRV_PAGE_ROW - 1) / LCD_DRV_PAGE_ROW) * LCD_DRV_PAGE_ROW;
+    line = (line > LCD_MAX_Y) ? LCD_MAX_Y : line;
+
+    lcd_scroll_view(line);
+    if (bcolor != LCD_COL_WHITE)
+    {
+        lcd_rectangle(0, LCD_MAX_Y - line, LCD_MAX_X - 1, LCD_MAX_Y - 1, bcolor, 1);
+    }
+
+    return lcd_puts(0, LCD_MAX_Y - line, str, bcolor, fcolor);
+}
+
 /*****************************************************************************
 函 数 名  : led_text_s
 功能描述  : 自动显示一串文本,支持换行回车,支持自动换行(只写入显存,不更新硬件)
@@ -767,6 +1083,33 @@ void lcd_rectangle(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t colou
     }
 }
 
+/*
+* lcd_span_mark / lcd_span_fill:
+*	Filled shapes collect the widest half span of every screen row first,
+*	then write each row once as one lcd_drv_hspan.
+*******************************************************************************
+*/
+static void lcd_span_mark(int32_t *half, int32_t row, int32_t w)
+{
+    if ((row >= 0) && (row < LCD_MAX_Y) && (w > half[row]))
+    {
+        half[row] = w;
+    }
+}
+
+static void lcd_span_fill(const int32_t *half, int32_t cx, int32_t colour)
+{
+    int32_t row = 0;
+
+    for (row = 0; row < LCD_MAX_Y; row++)
+    {
+        if (half[row] >= 0)
+        {
+            lcd_drv_hspan(cx - half[row], cx + half[row], row, colour);
+        }
+    }
+}
+
 /*
 * lcd__circle:
 *      This is the midpoint32 circle algorithm.
@@ -780,11 +1123,17 @@ void lcd_circle(int32_t x, int32_t y, int32_t r, int32_t colour, int32_t filled)
     int32_t f = 1 - r;
     int32_t x1 = 0;
     int32_t y1 = r;
+    int32_t half[LCD_MAX_Y];
+    int32_t row = 0;
 
     if (filled)
     {
-        lcd_line(x, y + r, x, y - r, colour);
-        lcd_line(x + r, y, x - r, y, colour);
+        memset(half, 0xFF, sizeof(half));
+        for (row = ((y - r) < 0) ? 0 : (y - r); (row <= (y + r)) && (row < LCD_MAX_Y); row++)
+        {
+            lcd_span_mark(half, row, 0);
+        }
+        lcd_span_mark(half, y, r);
     }
     else
     {
@@ -807,10 +1156,10 @@ void lcd_circle(int32_t x, int32_t y, int32_t r, int32_t colour, int32_t filled)
         f += ddF_x;
         if (filled)
         {
-            lcd_line(x + x1, y + y1, x - x1, y + y1, colour);
-            lcd_line(x + x1, y - y1, x - x1, y - y1, colour);
-            lcd_line(x + y1, y + x1, x - y1, y + x1, colour);
-            lcd_line(x + y1, y - x1, x - y1, y - x1, colour);
+            lcd_span_mark(half, y + y1, x1);
+            lcd_span_mark(half, y - y1, x1);
+            lcd_span_mark(half, y + x1, y1);
+            lcd_span_mark(half, y - x1, y1);
         }
         else
         {
@@ -824,6 +1173,11 @@ void lcd_circle(int32_t x, int32_t y, int32_t r, int32_t colour, int32_t filled)
             lcd_set_point(x - y1, y - x1, colour);
         }
     }
+
+    if (filled)
+    {
+        lcd_span_fill(half, x, colour);
+    }
 }
 
 /*
@@ -839,12 +1193,12 @@ void lcd_circle(int32_t x, int32_t y, int32_t r, int32_t colour, int32_t filled)
 *******************************************************************************
 */
 static void plot4ellipsePoints(int32_t cx, int32_t cy, int32_t x, int32_t y,
-                               int32_t colour, int32_t filled)
+                               int32_t colour, int32_t *half)
 {
-    if (filled)
+    if (half != NULL)
     {
-        lcd_line(cx + x, cy + y, cx - x, cy + y, colour);
-        lcd_line(cx - x, cy - y, cx + x, cy - y, colour);
+        lcd_span_mark(half, cy + y, x);
+        lcd_span_mark(half, cy - y, x);
     }
     else
     {
@@ -861,7 +1215,10 @@ void lcd_ellipse(int32_t cx, int32_t cy, int32_t xRadius, int32_t yRadius, int32
     int32_t xChange, yChange, ellipseError;
     int32_t twoAsquare, twoBsquare;
     int32_t stoppingX, stoppingY;
+    int32_t half[LCD_MAX_Y];
+    int32_t *phalf = filled ? half : NULL;
 
+    memset(half, 0xFF, sizeof(half));
     twoAsquare = 2 * xRadius * xRadius;
     twoBsquare = 2 * yRadius * yRadius;
 
@@ -877,7 +1234,7 @@ void lcd_ellipse(int32_t cx, int32_t cy, int32_t xRadius, int32_t yRadius, int32
 
     while (stoppingX >= stoppingY) // 1st set of point32s
     {
-        plot4ellipsePoints(cx, cy, x, y, colour, filled);
+        plot4ellipsePoints(cx, cy, x, y, colour, phalf);
         ++y;
         stoppingY += twoAsquare;
         ellipseError += yChange;
@@ -904,7 +1261,7 @@ void lcd_ellipse(int32_t cx, int32_t cy, int32_t xRadius, int32_t yRadius, int32
 
     while (stoppingX <= stoppingY) //2nd set of point32s
     {
-        plot4ellipsePoints(cx, cy, x, y, colour, filled);
+        plot4ellipsePoints(cx, cy, x, y, colour, phalf);
         ++x;
         stoppingX += twoBsquare;
         ellipseError += xChange;
@@ -918,6 +1275,11 @@ void lcd_ellipse(int32_t cx, int32_t cy, int32_t xRadius, int32_t yRadius, int32
             yChange += twoAsquare;
         }
     }
+
+    if (filled)
+    {
+        lcd_span_fill(half, cx, colour);
+    }
 }
 
 /*
@@ -933,7 +1295,7 @@ int32_t lcd_putbmp(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8
     //width = ((width + x0) >= LCD_MAX_X) ? LCD_MAX_X - x0 : width;
     //height = ((height + y0) >= LCD_MAX_Y) ? LCD_MAX_Y - y0 : height;
 
-    return lcd_blk_cpy2mem_b(bmp, x0, y0, x0, x0 + width, width, height, !colour, colour);
+    return lcd_blk_cpy2mem_b(bmp, x0, y0, x0, x0 + width, width, height, LCD_LEVEL_MAP[!colour], LCD_LEVEL_MAP[colour & LCD_DRV_COLOUR_BIT_MSK]);
 }
 
 /*
@@ -944,5 +1306,127 @@ int32_t lcd_putbmp(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8
 int32_t lcd_putbmpspeed(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t colour)
 {
     lcd_drv_bmp_speed(x0, y0, width, height, bmp, colour);
+    return OK;
+}
+
+/*
+* lcd_blitbmp:
+*	Copy a page format picture into the framebuffer, sent by the next lcd_flush.
+*********************************************************************************
+*/
+int32_t lcd_blitbmp(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t colour)
+{
+    if ((bmp == NULL) || (width <= 0) || (height <= 0))
+    {
+        return ERROR;
+    }
+
+    lcd_drv_blit(x0, y0, width, height, bmp, colour, LCD_LEVEL_IDENTITY ? NULL : &LCD_LEVEL_LUT[colour != 0]);
+    return OK;
+}
+
+/*
+* lcd_blitview:
+*	Copy the width x height window at (sx, sy) of a larger page format picture
+*	into the framebuffer, sent by the next lcd_flush.
+*********************************************************************************
+*/
+int32_t lcd_blitview(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t stride, int32_t pages,
+                     int32_t sx, int32_t sy, int32_t colour)
+{
+    if ((bmp == NULL) || (width <= 0) || (height <= 0) || (stride <= 0) || (pages <= 0))
+    {
+        return ERROR;
+    }
+
+    lcd_drv_blit_view(x0, y0, width, height, bmp, stride, pages, sx, sy, colour,
+                      LCD_LEVEL_IDENTITY ? NULL : &LCD_LEVEL_LUT[colour != 0]);
+    return OK;
+}
+
+/*
+* lcd_blitview_mono:
+*	lcd_blitview for 1bit page format pictures, 8 rows per page.
+*********************************************************************************
+*/
+int32_t lcd_blitview_mono(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t stride, int32_t pages,
+                          int32_t sx, int32_t sy, int32_t colour)
+{
+    if ((bmp == NULL) || (width <= 0) || (height <= 0) || (stride <= 0) || (pages <= 0))
+    {
+        return ERROR;
+    }
+
+    lcd_drv_blit_view_mono(x0, y0, width, height, bmp, stride, pages, sx, sy, colour,
+                           LCD_LEVEL_IDENTITY ? NULL : &LCD_LEVEL_LUT[colour != 0]);
+    return OK;
+}
+
+/*
+* lcd_putgray:
+*	Dither an 8bit gray picture straight into the framebuffer.
+*********************************************************************************
+*/
+int32_t lcd_putgray(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *gray, int32_t stride, dither_mode_t mode)
+{
+    int32_t rows = 0, page = 0, wrap = 0;
+    int32_t full = 0, p = 0, x = 0;
+    uint8_t mask = 0;
+    uint8_t *dst = NULL;
+    uint8_t tail[LCD_DRV_PAGE_MAX * LCD_MAX_X];
+
+    if ((gray == NULL) || (x0 < 0) || (y0 < 0) || (x0 >= LCD_MAX_X) || (y0 >= LCD_MAX_Y) || ((y0 % LCD_DRV_PAGE_ROW) != 0))
+    {
+        return ERROR;
+    }
+
+    width = ((width + x0) > LCD_MAX_X) ? (LCD_MAX_X - x0) : width;
+    height = ((height + y0) > LCD_MAX_Y) ? (LCD_MAX_Y - y0) : height;
+
+    lcd_drv_mark_dirty(x0, y0, width, height);
+
+    //滚动后显存页是环形的, 在环的末尾分成两段
+    while (height > 0)
+    {
+        page = y0 / LCD_DRV_PAGE_ROW;
+        for (wrap = page + 1; (wrap < LCD_DRV_PAGE_MAX) && (lcd_drv_get_page(wrap) > lcd_drv_get_page(page)); wrap++);
+        rows = (wrap - page) * LCD_DRV_PAGE_ROW;
+        rows = (rows > height) ? height : rows;
+
+        dst = lcd_drv_get_page(page) + x0;
+        if ((rows % LCD_DRV_PAGE_ROW) == 0)
+        {
+            if (dither_2bpp(mode, gray, stride, width, rows, dst, LCD_MAX_X) != OK)
+            {
+                return ERROR;
+            }
+        }
+        else
+        {
+            //最后一页不满, dither_2bpp 会把页内图像下方的行填成白色,
+            //先抖动到临时缓冲, 最后一页按行掩码合并, 保留下方原来的内容
+            if (dither_2bpp(mode, gray, stride, width, rows, tail, width) != OK)
+            {
+                return ERROR;
+            }
+
+            full = rows / LCD_DRV_PAGE_ROW;
+            for (p = 0; p < full; p++)
+            {
+                memcpy(dst + p * LCD_MAX_X, tail + p * width, width);
+            }
+
+            mask = (uint8_t)(0xFF << ((LCD_DRV_PAGE_ROW - rows % LCD_DRV_PAGE_ROW) * LCD_DRV_COLOUR_BIT));
+            dst += full * LCD_MAX_X;
+            for (x = 0; x < width; x++)
+            {
+                dst[x] = (uint8_t)((dst[x] & ~mask) | (tail[full * width + x] & mask));
+            }
+        }
+        gray += (size_t)rows * stride;
+        y0 += rows;
+        height -= rows;
+    }
+
     return OK;
 }
\ No newline at end of file
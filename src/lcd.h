@@ -12,6 +12,8 @@
 
 #include "lcd192x96.h"
 
+#include "dither.h"
+
 #define LCD_MAX_X (LCD_DRV_MAX_X)
 #define LCD_MAX_Y (LCD_DRV_MAX_Y)
 
@@ -30,8 +32,25 @@ typedef enum lcd_color_e
 
 #define LCD_DEFAULT_FONT FONT_17X24
 
+//lcd_puts_s 整串渲染为条带并缓存(strip.c), 0 为逐字逐点画
+#define LCD_STRIP_CACHE 1
+
+//lcd_putc_scale 支持的最大放大倍数
+#define LCD_SCALE_MAX (3)
+
 void delay_xms(uint32_t ms);
 
+/*****************************************************************************
+函 数 名  : lcd_lock
+功能描述  : 显存和总线只有一份, 多个线程写显存并刷新时用此锁互斥,
+            写完显存到 lcd_flush 结束应在同一次加锁内完成
+输入参数  : void
+输出参数  : 无
+返 回 值  : 无
+*****************************************************************************/
+void lcd_lock(void);
+void lcd_unlock(void);
+
 /*****************************************************************************
 函 数 名  : led_set_mirror
 功能描述  : 设置屏幕镜像显示
@@ -59,6 +78,38 @@ extern void lcd_init(void);
 *****************************************************************************/
 extern void lcd_update(void);
 
+/*****************************************************************************
+函 数 名  : lcd_set_level_map
+功能描述  : 设置灰度级重映射(按屏幕批次调整灰度响应, 不需要重新编码视频),
+            之后的视频帧(lcd_blitbmp)和 lcd_putbmp 都按此映射, 视频帧用
+            256项字节查找表(SIMD半字节查表)一次处理4个像素
+输入参数  : map  map[level] 为 level(0白-3黑) 显示时使用的灰度级, NULL 为恒等映射
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+extern int32_t lcd_set_level_map(const uint8_t *map);
+
+/*****************************************************************************
+函 数 名  : lcd_flush
+功能描述  : 只把显存中修改过的页(列范围)写入硬件, 连续的脏页合并为一次传输
+输入参数  : void
+输出参数  : 无
+返 回 值  : 无
+*****************************************************************************/
+extern void lcd_flush(void);
+
+/*****************************************************************************
+函 数 名  : lcd_set_depth
+功能描述  : 设置屏幕显示模式, 2-4级灰度, 1-单色(传输数据量减半, 深灰和黑显示
+            为黑). 显存格式不变, 切换后下一次 lcd_flush 重发整屏.
+            调用者需持有 lcd_lock
+输入参数  : bits  每像素位数(1或2)
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+extern int32_t lcd_set_depth(int32_t bits);
+extern int32_t lcd_get_depth(void);
+
 /*****************************************************************************
 函 数 名  : led_clear
 功能描述  : 用制定颜色填充(刷新)显存
@@ -108,6 +159,8 @@ font_name_t font 要设置的字体名
 返 回 值  : 无
 *****************************************************************************/
 extern void lcd_set_font(font_name_t font);
+extern font_t *lcd_get_font(void);
+extern int32_t _check_invalid_char_(int8_t chr);
 
 /*****************************************************************************
 函 数 名  : led_blk_cpy2mem_s
@@ -199,6 +252,41 @@ int32 fcolor    前景色
 *****************************************************************************/
 extern int32_t lcd_puts_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor);
 
+/*****************************************************************************
+函 数 名  : lcd_puts_clip
+功能描述  : 与 lcd_puts_s 相同, 只画可见的字符, 开销与可视宽度成正比而与字符串
+            长度无关(长字符串在窄窗口中滚动时使用)
+输入参数  : 同 lcd_puts_s
+输出参数  : 无
+返 回 值  : 0-成功,1-失败
+*****************************************************************************/
+extern int32_t lcd_puts_clip(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor);
+
+/*****************************************************************************
+函 数 名  : lcd_putc_scale
+功能描述  : 把当前字体的字符放大 scale 倍显示(只写入显存,不更新硬件). 每列点阵
+            按查表展开后直接拼成页格式字节, 横向按字节复制, 不逐点画;
+            大字可以用小字体放大得到, 不必另带大字库
+输入参数  : x_pos           字符的x坐标
+            x_disp0, x_disp1 可视部分的起止列(包含)
+            y_pos           字符的y坐标
+            chr             字符
+            scale           放大倍数, 1 - LCD_SCALE_MAX
+            bcolor, fcolor  背景色和前景色
+输出参数  : 无
+返 回 值  : 0-成功,1-失败
+*****************************************************************************/
+extern int32_t lcd_putc_scale(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t chr, int32_t scale, int32_t bcolor, int32_t fcolor);
+
+/*****************************************************************************
+函 数 名  : lcd_puts_scale
+功能描述  : 用 lcd_putc_scale 显示字符串的可视部分, 字符宽度为字体宽度的 scale 倍
+输入参数  : 同 lcd_puts_s, scale 为放大倍数
+输出参数  : 无
+返 回 值  : 0-成功,1-失败
+*****************************************************************************/
+extern int32_t lcd_puts_scale(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t scale, int32_t bcolor, int32_t fcolor);
+
 /*****************************************************************************
 函 数 名  : led_scroll_puts
 功能描述  : 滚动显示一个字符串图像(只写入显存,不更新硬件)
@@ -234,6 +322,42 @@ int32 fcolor    前景色
 *****************************************************************************/
 extern int32_t lcd_scroll_puts_s(int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor, int32_t delay);
 
+/*****************************************************************************
+函 数 名  : lcd_scroll_view
+功能描述  : 整屏垂直滚动(硬件显示起始行), 画图坐标不受影响, 仍以屏幕左上角
+            为原点. 只有新露出的行被清为白色并标记为脏, 下一次 lcd_flush
+            只发送起始行命令和这些行, 不重发整屏
+输入参数  : int32 dy  滚动的行数, 向零取整到页(4行), 正数内容上移
+输出参数  : 无
+返 回 值  : 无
+*****************************************************************************/
+extern void lcd_scroll_view(int32_t dy);
+
+/*****************************************************************************
+函 数 名  : lcd_hshift
+功能描述  : 把显存中一个矩形区域内的图像水平移动 dx 列(负数向左), 移出的
+            列保持原样由调用者重画, 整个区域标记为脏(只写入显存)
+输入参数  : int32 x0, y0          区域左上角
+            int32 width, height   区域大小
+            int32 dx              移动的列数
+输出参数  : 无
+返 回 值  : 无
+*****************************************************************************/
+extern void lcd_hshift(int32_t x0, int32_t y0, int32_t width, int32_t height, int32_t dx);
+
+/*****************************************************************************
+函 数 名  : lcd_log_puts
+功能描述  : 日志视图: 整屏上移一行文字的高度, 在最底下一行显示字符串
+            (只写入显存, 由 lcd_flush 发送)
+输入参数  :
+char *str       要显示的字符串
+int32 bcolor    背景色
+int32 fcolor    前景色
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+extern int32_t lcd_log_puts(int8_t *str, int32_t bcolor, int32_t fcolor);
+
 /*****************************************************************************
 函 数 名  : led_text_s
 功能描述  : 自动显示一串文本,支持换行回车,支持自动换行(只写入显存,不更新硬件)
@@ -258,4 +382,67 @@ extern void lcd_ellipse(int32_t cx, int32_t cy, int32_t xRadius, int32_t yRadius
 extern int32_t lcd_putbmp(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t colour);
 extern int32_t lcd_putbmpspeed(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t colour);
 
+/*****************************************************************************
+函 数 名  : lcd_blitbmp
+功能描述  : 把一幅页格式图像写入显存并标记为脏(只写入显存,由 lcd_flush 发送)
+输入参数  :
+int32 x0      左上角x坐标
+int32 y0      左上角y坐标, 向下取整到页
+int32 width   图像宽度
+int32 height  图像高度
+uchar *bmp    页格式图像
+int32 colour  颜色(0-反色)
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+extern int32_t lcd_blitbmp(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : lcd_blitview
+功能描述  : 把大于屏幕的页格式图像中的一个窗口直接写入显存(不经过中间缓冲),
+            sy 不必页对齐
+输入参数  :
+int32 x0      左上角x坐标
+int32 y0      左上角y坐标, 向下取整到页
+int32 width   窗口宽度
+int32 height  窗口高度
+uchar *bmp    页格式图像
+int32 stride  图像每页的字节数(图像宽度)
+int32 pages   图像的页数
+int32 sx      窗口在图像中的x坐标
+int32 sy      窗口在图像中的y坐标
+int32 colour  颜色(0-反色)
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+extern int32_t lcd_blitview(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t stride, int32_t pages,
+                            int32_t sx, int32_t sy, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : lcd_blitview_mono
+功能描述  : 与 lcd_blitview 相同, 图像为1bit页格式(每页8行, 上方像素在bit7,
+            1为黑色), 写入显存时展开为白/黑两级
+输入参数  : 同 lcd_blitview, pages 为8行一页的页数
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+extern int32_t lcd_blitview_mono(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *bmp, int32_t stride, int32_t pages,
+                                 int32_t sx, int32_t sy, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : lcd_putgray
+功能描述  : 把一幅8bit灰度图抖动后直接写入显存(只写入显存,不更新硬件)
+输入参数  :
+int32 x0      左上角x坐标
+int32 y0      左上角y坐标, 必须是页(4行)对齐的
+int32 width   图像宽度
+int32 height  图像高度
+uchar *gray   8bit灰度图, 0为黑色, 255为白色
+int32 stride  gray每行的字节数
+dither_mode_t mode 抖动方式
+输出参数  : 无
+返 回 值  : 0-成功,-1-失败
+*****************************************************************************/
+extern int32_t lcd_putgray(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8 *gray, int32_t stride, dither_mode_t mode);
+
 #endif // !_LCD_SIMULATOR_H_
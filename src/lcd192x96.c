@@ -82,6 +82,25 @@ static uint8_t frameBuffer[LCD_DRV_PAGE_MAX][LCD_DRV_MAX_X] = {0};
 static const uint8_t BIT_SET[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
 static const uint8_t BIT_CLR[8] = {0xFE, 0XFD, 0XFB, 0XF7, 0XEF, 0XDF, 0XBF, 0X7F};
 
+// Dirty column range [dirtyX0, dirtyX1) of every page, empty when dirtyX0 >= dirtyX1
+static uint8_t dirtyX0[LCD_DRV_PAGE_MAX] = {0};
+static uint8_t dirtyX1[LCD_DRV_PAGE_MAX] = {0};
+
+// Panel display mode, the framebuffer stays 2bpp and is packed to 1bpp when sent in mono mode
+static uint8_t dispMode = LCD_DISP_MODE_GRAY;
+
+// 2bpp byte (4 rows) -> 4 mono bits, dark grey and black show as black
+static uint8_t MONO_NIB[256] = {0};
+
+// 1bpp nibble (4 rows, top pixel in the high bit) -> 2bpp byte
+static const uint8_t MONO_EXPAND[16] = {0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+                                        0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF};
+
+// Hardware scroll: logical page p is stored in (and sent to) GDDRAM page LCD_DRV_PHY_PAGE(p)
+static int32_t scrollPage = 0;
+static int32_t scrollSync = 0;
+#define LCD_DRV_PHY_PAGE(p) (((p) + scrollPage) % LCD_DRV_PAGE_MAX)
+
 static int32_t lastX = 0, lastY = 0;
 static int32_t mirrorX = 0, mirrorY = 0;
 
@@ -132,19 +151,38 @@ void lcd_drv_set_pos(int32_t x0, int32_t y0)
 
   lcd_drv_send_data(0x75, LCD_SEND_MODE_CMD);                 //Page Address setting
   lcd_drv_send_data(y0, LCD_DISP_MODE_DAT);                 // YS=0
-  lcd_drv_send_data(LCD_DRV_PAGE_MAX - 1, LCD_DISP_MODE_DAT); // YE=95	  11->mono  23->gray
+  lcd_drv_send_data((dispMode == LCD_DISP_MODE_MONO) ? (LCD_DRV_MONO_PAGE_MAX - 1) : (LCD_DRV_PAGE_MAX - 1), LCD_DISP_MODE_DAT); // YE=95	  11->mono  23->gray
 
   lcd_drv_send_data(0x15, LCD_SEND_MODE_CMD);              //Clumn Address setting
   lcd_drv_send_data(x0, LCD_DISP_MODE_DAT);              // XS=0
   lcd_drv_send_data(LCD_DRV_MAX_X - 1, LCD_DISP_MODE_DAT); // XE=191
 }
 
+/*
+ * lcd_drv_set_start_line:
+ *	The whole 96 row screen is one scroll area, GDDRAM row (start + y) % 96
+ *	is shown on row y, so scrolling only needs the newly exposed rows.
+ *********************************************************************************
+ */
+static void lcd_drv_set_start_line(void)
+{
+  lcd_drv_send_data(0xAA, LCD_SEND_MODE_CMD);              // Scroll Area Set
+  lcd_drv_send_data(0x00, LCD_DISP_MODE_DAT);              // TL, no fixed top area
+  lcd_drv_send_data(LCD_DRV_MAX_Y - 1, LCD_DISP_MODE_DAT); // BL
+  lcd_drv_send_data(LCD_DRV_MAX_Y - 1, LCD_DISP_MODE_DAT); // NSL
+  lcd_drv_send_data(0x00, LCD_DISP_MODE_DAT);              // SCM, center screen scroll
+
+  lcd_drv_send_data(0xAB, LCD_SEND_MODE_CMD);                        // Set Display Start Line
+  lcd_drv_send_data(scrollPage * LCD_DRV_PAGE_ROW, LCD_DISP_MODE_DAT); // SL
+  scrollSync = 0;
+}
+
 void lcd_drv_set_mode(void)
 {
   lcd_drv_send_data(0x30, LCD_SEND_MODE_CMD); //EXT=0
 
-  lcd_drv_send_data(0xF0, LCD_SEND_MODE_CMD);               //Display Mode
-  lcd_drv_send_data(LCD_DISP_MODE_GRAY, LCD_DISP_MODE_DAT); //10=Mono, 11=4Gray
+  lcd_drv_send_data(0xF0, LCD_SEND_MODE_CMD); //Display Mode
+  lcd_drv_send_data(dispMode, LCD_DISP_MODE_DAT); //10=Mono, 11=4Gray
 
 #if 0
   lcd_drv_send_data(0x75, LCD_SEND_MODE_CMD);                 //Page Address setting
@@ -162,6 +200,8 @@ void lcd_drv_set_mode(void)
   lcd_drv_send_data(0x00, LCD_DISP_MODE_DAT);              // CL Dividing Ratio Not Divide
   lcd_drv_send_data(LCD_DRV_MAX_Y - 1, LCD_DISP_MODE_DAT); //Duty Set 96 Duty
   lcd_drv_send_data(0x00, LCD_DISP_MODE_DAT);              //Frame Inversion
+
+  lcd_drv_set_start_line();
 }
 
 void lcd_drv_test_gray()
@@ -294,6 +334,65 @@ void lcd_drv_hw_init(void)
   //delay_ms(1000);
 }
 
+/*
+ * lcd_drv_set_window:
+ *	Limit the following 0x5C write to pages p0..p1 and columns x0..x1 (inclusive).
+ *********************************************************************************
+ */
+static void lcd_drv_set_window(int32_t x0, int32_t x1, int32_t p0, int32_t p1)
+{
+  lcd_drv_send_data(0x75, LCD_SEND_MODE_CMD); //Page Address setting
+  lcd_drv_send_data(p0, LCD_DISP_MODE_DAT);
+  lcd_drv_send_data(p1, LCD_DISP_MODE_DAT);
+
+  lcd_drv_send_data(0x15, LCD_SEND_MODE_CMD); //Clumn Address setting
+  lcd_drv_send_data(x0, LCD_DISP_MODE_DAT);
+  lcd_drv_send_data(x1, LCD_DISP_MODE_DAT);
+}
+
+static void lcd_drv_clean_all(void)
+{
+  memset(dirtyX0, LCD_DRV_MAX_X, sizeof(dirtyX0));
+  memset(dirtyX1, 0, sizeof(dirtyX1));
+}
+
+/*
+ * lcd_drv_send_pages:
+ *	Send columns [x0, x1) of framebuffer pages [p0, p1). In mono mode every
+ *	two 2bpp pages are packed into one 8 row page, half the bytes on the wire.
+ *********************************************************************************
+ */
+static void lcd_drv_send_pages(int32_t x0, int32_t x1, int32_t p0, int32_t p1)
+{
+  int32_t p = 0, x = 0;
+
+  if (dispMode == LCD_DISP_MODE_MONO)
+  {
+    p0 = p0 / LCD_DRV_MONO_PAGE_SPAN;
+    p1 = (p1 + LCD_DRV_MONO_PAGE_SPAN - 1) / LCD_DRV_MONO_PAGE_SPAN;
+    lcd_drv_set_window(x0, x1 - 1, p0, p1 - 1);
+    lcd_drv_send_data(0x5C, LCD_SEND_MODE_CMD); // write data to lcd
+    for (p = p0 * LCD_DRV_MONO_PAGE_SPAN; p < p1 * LCD_DRV_MONO_PAGE_SPAN; p += LCD_DRV_MONO_PAGE_SPAN)
+    {
+      for (x = x0; x < x1; x++)
+      {
+        lcd_drv_send_data((uint8_t)((MONO_NIB[frameBuffer[p][x]] << 4) | MONO_NIB[frameBuffer[p + 1][x]]), LCD_DISP_MODE_DAT);
+      }
+    }
+    return;
+  }
+
+  lcd_drv_set_window(x0, x1 - 1, p0, p1 - 1);
+  lcd_drv_send_data(0x5C, LCD_SEND_MODE_CMD); // write data to lcd
+  for (p = p0; p < p1; p++)
+  {
+    for (x = x0; x < x1; x++)
+    {
+      lcd_drv_send_data(frameBuffer[p][x], LCD_DISP_MODE_DAT);
+    }
+  }
+}
+
 /*
  * lcd_drv_update:
  *	Copy our software version to the real display
@@ -301,16 +400,97 @@ void lcd_drv_hw_init(void)
  */
 void lcd_drv_update(void)
 {
-  uint8_t x = 0, y = 0;
   lcd_drv_set_mode();
-  lcd_drv_send_data(0x5C, LCD_SEND_MODE_CMD); // write data to lcd
-  for (y = 0; y < LCD_DRV_PAGE_MAX; y++)
+  lcd_drv_send_pages(0, LCD_DRV_MAX_X, 0, LCD_DRV_PAGE_MAX);
+  lcd_drv_clean_all();
+}
+
+/*
+ * lcd_drv_set_depth:
+ *	Switch the panel between 4 level gray (2) and mono (1) display. The
+ *	framebuffer keeps its 2bpp format; mono mode sends pixels of dark grey
+ *	and black as black. The whole screen is resent on the next flush.
+ *********************************************************************************
+ */
+void lcd_drv_set_depth(int32_t bits)
+{
+  uint8_t mode = (bits == 1) ? LCD_DISP_MODE_MONO : LCD_DISP_MODE_GRAY;
+
+  if (mode == dispMode)
+    return;
+
+  dispMode = mode;
+  lcd_drv_set_mode();
+  lcd_drv_mark_dirty(0, 0, LCD_DRV_MAX_X, LCD_DRV_MAX_Y);
+}
+
+int32_t lcd_drv_get_depth(void)
+{
+  return (dispMode == LCD_DISP_MODE_MONO) ? 1 : LCD_DRV_COLOUR_BIT;
+}
+
+/*
+ * lcd_drv_mark_dirty:
+ *	Mark a pixel rectangle of the framebuffer as changed.
+ *********************************************************************************
+ */
+void lcd_drv_mark_dirty(int32_t x0, int32_t y0, int32_t width, int32_t height)
+{
+  int32_t p = 0, p1 = 0, x1 = 0;
+
+  x1 = ((x0 + width) > LCD_DRV_MAX_X) ? LCD_DRV_MAX_X : (x0 + width);
+  p1 = ((y0 + height) > LCD_DRV_MAX_Y) ? LCD_DRV_MAX_Y : (y0 + height);
+  x0 = (x0 < 0) ? 0 : x0;
+  y0 = (y0 < 0) ? 0 : y0;
+  if ((x0 >= x1) || (y0 >= p1))
+    return;
+
+  p1 = (p1 + LCD_DRV_PAGE_ROW - 1) / LCD_DRV_PAGE_ROW;
+  for (p = y0 / LCD_DRV_PAGE_ROW; p < p1; p++)
   {
-    for (x = 0; x < LCD_DRV_MAX_X; x++)
+    if (x0 < dirtyX0[LCD_DRV_PHY_PAGE(p)])
+      dirtyX0[LCD_DRV_PHY_PAGE(p)] = (uint8_t)x0;
+    if (x1 > dirtyX1[LCD_DRV_PHY_PAGE(p)])
+      dirtyX1[LCD_DRV_PHY_PAGE(p)] = (uint8_t)x1;
+  }
+}
+
+/*
+ * lcd_drv_flush:
+ *	Send only the dirty part of the framebuffer. Runs of consecutive dirty
+ *	pages share one address window spanning the union of their columns, so
+ *	a full-width video frame costs one window setup and the frame bytes.
+ *	In mono mode a run is widened to whole 8 row pages.
+ *********************************************************************************
+ */
+void lcd_drv_flush(void)
+{
+  int32_t p0 = 0, p1 = 0;
+  int32_t x0 = 0, x1 = 0;
+
+  // new start line first, the exposed rows follow in the same flush
+  if (scrollSync)
+    lcd_drv_set_start_line();
+
+  for (p0 = 0; p0 < LCD_DRV_PAGE_MAX; p0 = p1)
+  {
+    if (dirtyX0[p0] >= dirtyX1[p0])
+    {
+      p1 = p0 + 1;
+      continue;
+    }
+
+    x0 = dirtyX0[p0];
+    x1 = dirtyX1[p0];
+    for (p1 = p0 + 1; (p1 < LCD_DRV_PAGE_MAX) && (dirtyX0[p1] < dirtyX1[p1]); p1++)
     {
-      lcd_drv_send_data(frameBuffer[y][x], LCD_DISP_MODE_DAT);
+      x0 = (dirtyX0[p1] < x0) ? dirtyX0[p1] : x0;
+      x1 = (dirtyX1[p1] > x1) ? dirtyX1[p1] : x1;
     }
+
+    lcd_drv_send_pages(x0, x1, p0, p1);
   }
+  lcd_drv_clean_all();
 }
 
 /*
@@ -324,6 +504,7 @@ void lcd_drv_set_point(int32_t x, int32_t y, int32_t colour)
   uint8_t bitmv = 0;
   uint8_t colour_t = (uint8_t)colour;
   uint8_t frameBuffer_t = 0;
+  int32_t page = 0;
   if (mirrorX)
     x = (LCD_DRV_MAX_X - x - 1);
 
@@ -340,13 +521,19 @@ void lcd_drv_set_point(int32_t x, int32_t y, int32_t colour)
   bitmsk = (y % LCD_DRV_PAGE_ROW);
   bitmv = ((LCD_DRV_PAGE_ROW - bitmsk - 1) * LCD_DRV_COLOUR_BIT);
 
-  frameBuffer_t = frameBuffer[y / LCD_DRV_PAGE_ROW][x];
+  page = LCD_DRV_PHY_PAGE(y / LCD_DRV_PAGE_ROW);
+  frameBuffer_t = frameBuffer[page][x];
 
   frameBuffer_t = (frameBuffer_t & ((uint8_t)(~(LCD_DRV_COLOUR_BIT_MSK << bitmv))));
 
   frameBuffer_t = (frameBuffer_t | ((uint8_t)(colour_t << bitmv)));
 
-  frameBuffer[y / LCD_DRV_PAGE_ROW][x] = frameBuffer_t;
+  frameBuffer[page][x] = frameBuffer_t;
+
+  if (x < dirtyX0[page])
+    dirtyX0[page] = x;
+  if (x >= dirtyX1[page])
+    dirtyX1[page] = x + 1;
 }
 
 /*
@@ -372,7 +559,7 @@ int32_t lcd_drv_get_point(int32_t x, int32_t y)
   bitmsk = (y % LCD_DRV_PAGE_ROW);
   bitmv = ((LCD_DRV_PAGE_ROW - bitmsk - 1) * LCD_DRV_COLOUR_BIT);
 
-  frameBuffer_t = frameBuffer[y / LCD_DRV_PAGE_ROW][x];
+  frameBuffer_t = frameBuffer[LCD_DRV_PHY_PAGE(y / LCD_DRV_PAGE_ROW)][x];
 
   frameBuffer_t = ((uint8_t)(frameBuffer_t >> bitmv));
   colour = frameBuffer_t & LCD_DRV_COLOUR_BIT_MSK;
@@ -402,7 +589,7 @@ void lcd_drv_bmp_speed(int32_t x0, int32_t y0, int32_t width, int32_t height, ui
   #if 1
   for (y = y0; y < y0 + height; y++)
   {
-    lcd_drv_set_pos(x0, y);
+    lcd_drv_set_pos(x0, LCD_DRV_PHY_PAGE(y));
     lcd_drv_send_data(0x5C, LCD_SEND_MODE_CMD); // write data to lcd
     for (x = x0; x < x0 + width; x++)
     {
@@ -436,6 +623,409 @@ void lcd_drv_bmp_speed(int32_t x0, int32_t y0, int32_t width, int32_t height, ui
   
 }
 
+/*
+ * lcd_drv_blit:
+ *	Copy a page format picture into the framebuffer and mark it dirty,
+ *	nothing is sent until lcd_drv_flush. A non NULL lut remaps the gray
+ *	levels on the way and already includes the colour inversion.
+ *********************************************************************************
+ */
+void lcd_drv_blit(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t colour, const gray_lut_t *lut)
+{
+  lcd_drv_blit_view(x0, y0, width, height, bmp, width, (height + LCD_DRV_PAGE_ROW - 1) / LCD_DRV_PAGE_ROW, 0, 0, colour, lut);
+}
+
+/*
+ * lcd_drv_blit_clip:
+ *	Clip a blit of a source with rows pixel rows to the source and the
+ *	screen. Leaves y0 and height in framebuffer pages, 0 if nothing is left.
+ *********************************************************************************
+ */
+static int32_t lcd_drv_blit_clip(int32_t *x0, int32_t *y0, int32_t *width, int32_t *height, int32_t stride, int32_t rows,
+                                 int32_t sx, int32_t sy)
+{
+  if ((sx < 0) || (sy < 0) || (sx >= stride) || (sy >= rows))
+    return 0;
+
+  *width = ((*width + sx) > stride) ? stride - sx : *width;
+  *height = ((*height + sy) > rows) ? rows - sy : *height;
+
+  // same clipping and page rounding as lcd_drv_bmp_speed
+  *x0 = ((*x0 >= LCD_DRV_MAX_X) ? (LCD_DRV_MAX_X - 1) : ((*x0 < 0) ? 0 : *x0));
+  *y0 = ((*y0 >= LCD_DRV_MAX_Y) ? (LCD_DRV_MAX_Y - 1) : ((*y0 < 0) ? 0 : *y0));
+
+  *height = ((*height + *y0) >= LCD_DRV_MAX_Y) ? LCD_DRV_MAX_Y - *y0 : *height;
+  *y0 = ((*y0 % LCD_DRV_PAGE_ROW == 0) ? (*y0 / LCD_DRV_PAGE_ROW) : (*y0 / LCD_DRV_PAGE_ROW + 1));
+  *width = ((*width + *x0) >= LCD_DRV_MAX_X) ? LCD_DRV_MAX_X - *x0 : *width;
+  *height = ((*height % LCD_DRV_PAGE_ROW == 0) ? (*height / LCD_DRV_PAGE_ROW) : (*height / LCD_DRV_PAGE_ROW + 1));
+  *height = ((*height + *y0) > LCD_DRV_PAGE_MAX) ? LCD_DRV_PAGE_MAX - *y0 : *height;
+
+  return (*width > 0) && (*height > 0);
+}
+
+static void lcd_drv_blit_mark(int32_t x0, int32_t x1, int32_t p)
+{
+  if (x0 < dirtyX0[p])
+    dirtyX0[p] = x0;
+  if (x1 > dirtyX1[p])
+    dirtyX1[p] = x1;
+}
+
+/*
+ * lcd_drv_blit_view:
+ *	Copy the width x height window at (sx, sy) of a larger page format
+ *	picture (stride bytes per page, pages pages) straight into the
+ *	framebuffer. An sy that is not page aligned merges two source pages
+ *	into every destination byte; rows below the source read as white.
+ *********************************************************************************
+ */
+void lcd_drv_blit_view(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t stride, int32_t pages,
+                       int32_t sx, int32_t sy, int32_t colour, const gray_lut_t *lut)
+{
+  int32_t x = 0, y = 0;
+  int32_t sp = 0, shift = 0;
+  uint8_t *dst = NULL;
+  uint8_t *src0 = NULL, *src1 = NULL;
+
+  if (!lcd_drv_blit_clip(&x0, &y0, &width, &height, stride, pages * LCD_DRV_PAGE_ROW, sx, sy))
+    return;
+
+  // the top pixel is in the high bits, moving up k rows is a left shift of 2k bits
+  shift = (sy % LCD_DRV_PAGE_ROW) * LCD_DRV_COLOUR_BIT;
+  sp = sy / LCD_DRV_PAGE_ROW;
+  for (y = y0; y < y0 + height; y++, sp++)
+  {
+    dst = &frameBuffer[LCD_DRV_PHY_PAGE(y)][x0];
+    src0 = bmp + sp * stride + sx;
+    if (shift != 0)
+    {
+      src1 = ((sp + 1) < pages) ? (src0 + stride) : NULL;
+      for (x = 0; x < width; x++)
+      {
+        dst[x] = (uint8_t)((src0[x] << shift) | ((src1 != NULL) ? (src1[x] >> (8 - shift)) : 0));
+      }
+      src0 = dst;
+    }
+
+    if (lut != NULL)
+    {
+      gray_lut_apply(lut, src0, dst, width);
+    }
+    else if (colour != 0)
+    {
+      if (src0 != dst)
+        memcpy(dst, src0, width);
+    }
+    else
+    {
+      for (x = 0; x < width; x++)
+      {
+        dst[x] = (uint8_t)~src0[x];
+      }
+    }
+
+    lcd_drv_blit_mark(x0, x0 + width, LCD_DRV_PHY_PAGE(y));
+  }
+}
+
+/*
+ * lcd_drv_mono_row:
+ *	Expand the 4 rows starting at bit (0 = top row) of a row of 1bpp
+ *	source pages into 2bpp framebuffer bytes. Each case has its own loop
+ *	so the per byte work is one shift and one table load; only rows that
+ *	straddle two source pages read src1, which is NULL on the last page.
+ *********************************************************************************
+ */
+static void lcd_drv_mono_row(uint8_t *dst, const uint8_t *src0, const uint8_t *src1, int32_t bit, int32_t width, uint8_t inv)
+{
+  int32_t x = 0;
+  int32_t shift = 0;
+
+  if (bit <= 4)
+  {
+    shift = 4 - bit;
+    for (x = 0; x < width; x++)
+    {
+      dst[x] = (uint8_t)(MONO_EXPAND[(src0[x] >> shift) & 0x0F] ^ inv);
+    }
+  }
+  else if (src1 == NULL)
+  {
+    shift = bit - 4;
+    for (x = 0; x < width; x++)
+    {
+      dst[x] = (uint8_t)(MONO_EXPAND[(src0[x] << shift) & 0x0F] ^ inv);
+    }
+  }
+  else
+  {
+    shift = 12 - bit;
+    for (x = 0; x < width; x++)
+    {
+      dst[x] = (uint8_t)(MONO_EXPAND[((((uint32_t)src0[x] << 8) | src1[x]) >> shift) & 0x0F] ^ inv);
+    }
+  }
+}
+
+/*
+ * lcd_drv_blit_view_mono:
+ *	lcd_drv_blit_view for 1bpp pictures: every source page holds 8 rows,
+ *	the top pixel in bit 7, 1 is black. Each 2bpp framebuffer page takes
+ *	4 of those rows as white or black; a non NULL lut is applied after.
+ *********************************************************************************
+ */
+void lcd_drv_blit_view_mono(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t stride, int32_t pages,
+                            int32_t sx, int32_t sy, int32_t colour, const gray_lut_t *lut)
+{
+  int32_t y = 0, row = 0, bit = 0;
+  uint8_t *dst = NULL;
+  uint8_t *src0 = NULL, *src1 = NULL;
+  uint8_t inv = ((lut == NULL) && (colour == 0)) ? 0xFF : 0x00;
+
+  if (!lcd_drv_blit_clip(&x0, &y0, &width, &height, stride, pages * LCD_DRV_MONO_PAGE_ROW, sx, sy))
+    return;
+
+  for (y = y0, row = sy; y < y0 + height; y++, row += LCD_DRV_PAGE_ROW)
+  {
+    dst = &frameBuffer[LCD_DRV_PHY_PAGE(y)][x0];
+    src0 = bmp + (row / LCD_DRV_MONO_PAGE_ROW) * stride + sx;
+    src1 = (((row / LCD_DRV_MONO_PAGE_ROW) + 1) < pages) ? (src0 + stride) : NULL;
+    bit = row % LCD_DRV_MONO_PAGE_ROW;
+    lcd_drv_mono_row(dst, src0, src1, bit, width, inv);
+
+    if (lut != NULL)
+      gray_lut_apply(lut, dst, dst, width);
+
+    lcd_drv_blit_mark(x0, x0 + width, LCD_DRV_PHY_PAGE(y));
+  }
+}
+
+/*
+ * lcd_drv_page_mask:
+ *	Bits of page p that hold rows [y0, y1).
+ *********************************************************************************
+ */
+static uint8_t lcd_drv_page_mask(int32_t p, int32_t y0, int32_t y1)
+{
+  int32_t r = 0, r0 = 0, r1 = 0;
+  uint8_t mask = 0;
+
+  r0 = (y0 > p * LCD_DRV_PAGE_ROW) ? (y0 - p * LCD_DRV_PAGE_ROW) : 0;
+  r1 = (y1 < (p + 1) * LCD_DRV_PAGE_ROW) ? (y1 - p * LCD_DRV_PAGE_ROW) : LCD_DRV_PAGE_ROW;
+  for (r = r0; r < r1; r++)
+  {
+    mask |= (uint8_t)(LCD_DRV_COLOUR_BIT_MSK << ((LCD_DRV_PAGE_ROW - r - 1) * LCD_DRV_COLOUR_BIT));
+  }
+
+  return mask;
+}
+
+/*
+ * lcd_drv_hshift:
+ *	Move the pixels of a rectangle dx columns sideways (negative is left)
+ *	inside the framebuffer and mark the rectangle dirty. The columns moved
+ *	out of are left as they were for the caller to redraw. Whole pages are
+ *	one memmove, the partial pages at the top and bottom are masked.
+ *********************************************************************************
+ */
+void lcd_drv_hshift(int32_t x0, int32_t y0, int32_t width, int32_t height, int32_t dx)
+{
+  int32_t p = 0, x = 0, n = 0;
+  uint8_t mask = 0;
+  uint8_t *row = NULL;
+
+  width = ((x0 + width) > LCD_DRV_MAX_X) ? (LCD_DRV_MAX_X - x0) : width;
+  height = ((y0 + height) > LCD_DRV_MAX_Y) ? (LCD_DRV_MAX_Y - y0) : height;
+  if ((x0 < 0) || (y0 < 0) || (width <= 0) || (height <= 0) || (dx == 0))
+    return;
+
+  n = width - ((dx < 0) ? -dx : dx);
+  for (p = y0 / LCD_DRV_PAGE_ROW; (n > 0) && (p <= (y0 + height - 1) / LCD_DRV_PAGE_ROW); p++)
+  {
+    mask = lcd_drv_page_mask(p, y0, y0 + height);
+    row = frameBuffer[LCD_DRV_PHY_PAGE(p)] + x0;
+    if (mask == 0xFF)
+    {
+      if (dx < 0)
+        memmove(row, row - dx, n);
+      else
+        memmove(row + dx, row, n);
+    }
+    else if (dx < 0)
+    {
+      for (x = 0; x < n; x++)
+      {
+        row[x] = (uint8_t)((row[x] & ~mask) | (row[x - dx] & mask));
+      }
+    }
+    else
+    {
+      for (x = width - 1; x >= dx; x--)
+      {
+        row[x] = (uint8_t)((row[x] & ~mask) | (row[x - dx] & mask));
+      }
+    }
+  }
+
+  lcd_drv_mark_dirty(x0, y0, width, height);
+}
+
+/*
+ * lcd_drv_blit_strip:
+ *	Copy columns [sx, sx + width) of a pre-rendered strip to (x0, y0). The
+ *	strip holds height rows starting at row (y0 & 3) of its first page, the
+ *	same phase as the destination, so every page is a plain byte copy; only
+ *	the first and last page are masked to leave the rows around untouched.
+ *********************************************************************************
+ */
+void lcd_drv_blit_strip(int32_t x0, int32_t y0, int32_t width, int32_t height, const uint8_t *strip, int32_t stride, int32_t sx)
+{
+  int32_t p = 0, x = 0, ya = 0, yb = 0, base = 0;
+  uint8_t mask = 0;
+  uint8_t *dst = NULL;
+  const uint8_t *src = NULL;
+
+  if (x0 < 0)
+  {
+    sx -= x0;
+    width += x0;
+    x0 = 0;
+  }
+  width = ((x0 + width) > LCD_DRV_MAX_X) ? (LCD_DRV_MAX_X - x0) : width;
+  ya = (y0 < 0) ? 0 : y0;
+  yb = ((y0 + height) > LCD_DRV_MAX_Y) ? LCD_DRV_MAX_Y : (y0 + height);
+  if ((width <= 0) || (ya >= yb))
+    return;
+
+  // first strip page starts this many rows above y0
+  base = y0 - (((y0 % LCD_DRV_PAGE_ROW) + LCD_DRV_PAGE_ROW) % LCD_DRV_PAGE_ROW);
+  for (p = ya / LCD_DRV_PAGE_ROW; p <= (yb - 1) / LCD_DRV_PAGE_ROW; p++)
+  {
+    mask = lcd_drv_page_mask(p, ya, yb);
+    src = strip + ((p * LCD_DRV_PAGE_ROW - base) / LCD_DRV_PAGE_ROW) * stride + sx;
+    dst = frameBuffer[LCD_DRV_PHY_PAGE(p)] + x0;
+    if (mask == 0xFF)
+    {
+      memcpy(dst, src, width);
+    }
+    else
+    {
+      for (x = 0; x < width; x++)
+      {
+        dst[x] = (uint8_t)((dst[x] & ~mask) | (src[x] & mask));
+      }
+    }
+  }
+
+  lcd_drv_mark_dirty(x0, ya, width, yb - ya);
+}
+
+/*
+ * lcd_drv_hspan:
+ *	Fill columns [x0, x1] of row y with colour. The row is two bits of
+ *	one page, so the span is a single masked read-modify-write per byte
+ *	instead of a lcd_drv_set_point per pixel.
+ *********************************************************************************
+ */
+void lcd_drv_hspan(int32_t x0, int32_t x1, int32_t y, int32_t colour)
+{
+  int32_t x = 0, t = 0, page = 0, shift = 0;
+  uint8_t mask = 0, value = 0;
+  uint8_t *dst = NULL;
+
+  if (mirrorX)
+  {
+    t = x0;
+    x0 = LCD_DRV_MAX_X - x1 - 1;
+    x1 = LCD_DRV_MAX_X - t - 1;
+  }
+
+  if (mirrorY)
+    y = (LCD_DRV_MAX_Y - y - 1);
+
+  x0 = (x0 < 0) ? 0 : x0;
+  x1 = (x1 >= LCD_DRV_MAX_X) ? (LCD_DRV_MAX_X - 1) : x1;
+  if ((x0 > x1) || (y < 0) || (y >= LCD_DRV_MAX_Y))
+    return;
+
+  shift = (LCD_DRV_PAGE_ROW - (y % LCD_DRV_PAGE_ROW) - 1) * LCD_DRV_COLOUR_BIT;
+  mask = (uint8_t)(LCD_DRV_COLOUR_BIT_MSK << shift);
+  value = (uint8_t)((colour & LCD_DRV_COLOUR_BIT_MSK) << shift);
+  page = LCD_DRV_PHY_PAGE(y / LCD_DRV_PAGE_ROW);
+  dst = frameBuffer[page];
+  for (x = x0; x <= x1; x++)
+  {
+    dst[x] = (uint8_t)((dst[x] & ~mask) | value);
+  }
+
+  lcd_drv_blit_mark(x0, x1 + 1, page);
+}
+
+/*
+ * lcd_drv_get_buffer:
+ *	Return the software framebuffer, LCD_DRV_PAGE_MAX pages of LCD_DRV_MAX_X bytes
+ *	in GDDRAM order, logical page 0 is at lcd_drv_get_page(0) once scrolled.
+ *********************************************************************************
+ */
+uint8_t *lcd_drv_get_buffer(void)
+{
+  return &frameBuffer[0][0];
+}
+
+/*
+ * lcd_drv_get_page:
+ *	Return the framebuffer row holding logical page p. After lcd_drv_scroll
+ *	the pages are a ring, code writing the buffer directly must go page by page.
+ *********************************************************************************
+ */
+uint8_t *lcd_drv_get_page(int32_t p)
+{
+  return frameBuffer[LCD_DRV_PHY_PAGE(p)];
+}
+
+/*
+ * lcd_drv_scroll:
+ *	Scroll the view by dy rows (rounded towards zero to whole pages),
+ *	positive moves the content up. Only the display start line changes;
+ *	the exposed pages are cleared to white and marked dirty, so the next
+ *	flush sends the start line and those pages instead of the whole screen.
+ *********************************************************************************
+ */
+void lcd_drv_scroll(int32_t dy)
+{
+  int32_t pages = dy / LCD_DRV_PAGE_ROW;
+  int32_t p = 0, p0 = 0, p1 = 0;
+
+  if (pages == 0)
+    return;
+
+  if ((pages >= LCD_DRV_PAGE_MAX) || (pages <= -LCD_DRV_PAGE_MAX))
+  {
+    p0 = 0;
+    p1 = LCD_DRV_PAGE_MAX;
+    pages %= LCD_DRV_PAGE_MAX;
+  }
+  else if (pages > 0)
+  {
+    p0 = LCD_DRV_PAGE_MAX - pages;
+    p1 = LCD_DRV_PAGE_MAX;
+  }
+  else
+  {
+    p0 = 0;
+    p1 = -pages;
+  }
+
+  scrollPage = (scrollPage + pages + LCD_DRV_PAGE_MAX) % LCD_DRV_PAGE_MAX;
+  scrollSync = 1;
+
+  for (p = p0; p < p1; p++)
+  {
+    memset(frameBuffer[LCD_DRV_PHY_PAGE(p)], 0x00, LCD_DRV_MAX_X);
+  }
+  lcd_drv_mark_dirty(0, p0 * LCD_DRV_PAGE_ROW, LCD_DRV_MAX_X, (p1 - p0) * LCD_DRV_PAGE_ROW);
+}
+
 /*
  * lcd_drv_open:
  *	Open hardware display.
@@ -509,6 +1099,7 @@ void lcd_drv_clear(int32_t colour)
       frameBuffer[y][x] = col;
     }
   }
+  lcd_drv_mark_dirty(0, 0, LCD_DRV_MAX_X, LCD_DRV_MAX_Y);
 }
 
 /*
@@ -518,6 +1109,13 @@ void lcd_drv_clear(int32_t colour)
  */
 int32_t lcd_drv_init(void)
 {
+  int32_t i = 0;
+
+  for (i = 0; i < 256; i++)
+  {
+    MONO_NIB[i] = (uint8_t)(((i >> 4) & 0x08) | ((i >> 3) & 0x04) | ((i >> 2) & 0x02) | ((i >> 1) & 0x01));
+  }
+
   lcd_drv_hw_init();
 
   lcd_drv_open();
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <wiringPi.h>
+#include "gray.h"
 
 // Size
 #define LCD_DRV_MAX_X (192)
@@ -36,6 +37,9 @@
 #define LCD_DRV_COLOUR_BIT_MSK (0x03)
 #define LCD_DRV_PAGE_ROW (8 / LCD_DRV_COLOUR_BIT)
 #define LCD_DRV_PAGE_MAX (LCD_DRV_MAX_Y / LCD_DRV_PAGE_ROW)
+#define LCD_DRV_MONO_PAGE_ROW (8)
+#define LCD_DRV_MONO_PAGE_MAX (LCD_DRV_MAX_Y / LCD_DRV_MONO_PAGE_ROW)
+#define LCD_DRV_MONO_PAGE_SPAN (LCD_DRV_MONO_PAGE_ROW / LCD_DRV_PAGE_ROW)
 
 #define LCD_DRV_INCLUDE_GUILIB 0
 
@@ -51,7 +55,22 @@ typedef enum lcd_colour_e
 extern void lcd_drv_set_point(int32_t x, int32_t y, int32_t colour);
 extern int32_t lcd_drv_get_point(int32_t x, int32_t y);
 extern void lcd_drv_bmp_speed(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t colour);
+extern void lcd_drv_blit(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t colour, const gray_lut_t *lut);
+extern void lcd_drv_blit_view(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t stride, int32_t pages,
+                              int32_t sx, int32_t sy, int32_t colour, const gray_lut_t *lut);
+extern void lcd_drv_blit_view_mono(int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t *bmp, int32_t stride, int32_t pages,
+                                   int32_t sx, int32_t sy, int32_t colour, const gray_lut_t *lut);
+extern void lcd_drv_set_depth(int32_t bits);
+extern int32_t lcd_drv_get_depth(void);
 extern void lcd_drv_update(void);
+extern void lcd_drv_mark_dirty(int32_t x0, int32_t y0, int32_t width, int32_t height);
+extern void lcd_drv_flush(void);
+extern uint8_t *lcd_drv_get_buffer(void);
+extern uint8_t *lcd_drv_get_page(int32_t p);
+extern void lcd_drv_scroll(int32_t dy);
+extern void lcd_drv_hshift(int32_t x0, int32_t y0, int32_t width, int32_t height, int32_t dx);
+extern void lcd_drv_blit_strip(int32_t x0, int32_t y0, int32_t width, int32_t height, const uint8_t *strip, int32_t stride, int32_t sx);
+extern void lcd_drv_hspan(int32_t x0, int32_t x1, int32_t y, int32_t colour);
 extern void lcd_drv_open(void);
 extern void lcd_drv_close(void);
 extern void lcd_drv_hw_clear(void);
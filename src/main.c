@@ -6,6 +6,12 @@
 
 #include "lcd.h"
 #include "bmp.h"
+#include "stream.h"
+#include "frc.h"
+#include "pip.h"
+#include "playlist.h"
+#include "evloop.h"
+#include "rate.h"
 
 #define LCD_MOVIE_NAME_LEN (1024)
 
@@ -16,11 +22,181 @@ static void print_usage(const char *exe_name)
     printf("Usage: %s <file-path>...\r\n", exe_name);
     printf("Options:\r\n");
     printf(HELP_PRINT_FORMATS, "-h,--help", "Show this help message.");
-    printf(HELP_PRINT_FORMATS, "-f FILE_PATH,--file=FILE_PATH", "Lcd Movie Player File.");
+    printf(HELP_PRINT_FORMATS, "-f FILE_PATH,--file=FILE_PATH", "Lcd Movie Player File, '-' Reads Raw 8bit Gray Frames From Stdin, Repeat For A Playlist.");
+    printf(HELP_PRINT_FORMATS, "-L LIST_FILE,--list=LIST_FILE", "Play The Movies Listed In LIST_FILE (One Per Line) Without Gaps.");
+    printf(HELP_PRINT_FORMATS, "-c FIFO,--control=FIFO", "Accept pause/resume/step/speed X/seek MS/view X Y/quit From FIFO.");
+    printf(HELP_PRINT_FORMATS, "-g A,B,C,D,--levels=A,B,C,D", "Show Gray Levels 0-3 (White-Black) As A,B,C,D, e.g. 0,2,3,3.");
+    printf(HELP_PRINT_FORMATS, "-R FPS,--rate=FPS", "Display At FPS With Evenly Dropped Frames, 'auto' Measures The Panel.");
+    printf(HELP_PRINT_FORMATS, "-V X,Y,--view=X,Y", "Show The Panel Sized Window At X,Y Of A Movie Larger Than The Panel.");
     printf(HELP_PRINT_FORMATS, "-l LOOP_TIMES,--loop=LOOP_TIMES", "Loop Number Of Times.");
+    printf(HELP_PRINT_FORMATS, "-s START_MS,--start=START_MS", "Start Playing At START_MS.");
+    printf(HELP_PRINT_FORMATS, "-e END_MS,--end=END_MS", "Stop Playing At END_MS.");
+    printf(HELP_PRINT_FORMATS, "-S WxH,--size=WxH", "Stdin Frame Size (default 192x96).");
+    printf(HELP_PRINT_FORMATS, "-D,--drop", "Drop Oldest Stdin Frame When The Panel Falls Behind.");
+    printf(HELP_PRINT_FORMATS, "-d MODE,--dither=MODE", "Stdin Dither Mode: none, bayer, bluenoise, fs.");
+    printf(HELP_PRINT_FORMATS, "-F N[@HZ],--frc=N[@HZ]", "Stdin Temporal Dither, N Subframes (3N+1 Levels) At HZ Subframes/s.");
+    printf(HELP_PRINT_FORMATS, "-p FILE@X,Y,--pip=FILE@X,Y", "Loop Another Movie At X,Y Next To The Main One (Repeatable).");
     printf("\r\n");
 }
 
+typedef struct pip_arg_s
+{
+    char path[LCD_MOVIE_NAME_LEN + 1];
+    int x0;
+    int y0;
+} pip_arg_t;
+
+static int parse_pip(const char *arg, pip_arg_t *pip)
+{
+    const char *at = strrchr(arg, '@');
+
+    if ((at == NULL) || (at == arg) || ((at - arg) > LCD_MOVIE_NAME_LEN) || (sscanf(at + 1, "%d,%d", &pip->x0, &pip->y0) != 2))
+    {
+        return ERROR;
+    }
+
+    memset(pip->path, 0, sizeof(pip->path));
+    strncpy(pip->path, arg, at - arg);
+    return OK;
+}
+
+/*
+ * play_pip:
+ *	主视频按原位置播放一次(受 -s/-e 和 -V 限制), 其他视频循环播放在各自区域,
+ *	主视频播完后结束.
+ */
+static int play_pip(char *movie_path, int start_ms, int end_ms, int loop_times, int view_x, int view_y, pip_arg_t *pip, int pip_num)
+{
+    bmp_player_t *player[PIP_CLIP_MAX] = {NULL};
+    int ecode = 0;
+    int i = 0;
+
+    player[0] = bmp_player_open((int8_t *)movie_path);
+    if ((player[0] == NULL) || (((start_ms > 0) || (end_ms >= 0)) && (bmp_player_set_range_ms(player[0], start_ms, end_ms) != OK)))
+    {
+        DEBUG_ERR(ecode, "Movie Player Init Error!");
+        ecode = 2;
+        goto error;
+    }
+    bmp_player_set_view(player[0], view_x, view_y);
+    pip_add(player[0], bmp_player_center_x(player[0]), 0, LCD_COL_TRUE, 0);
+
+    for (i = 0; i < pip_num; i++)
+    {
+        player[i + 1] = bmp_player_open((int8_t *)pip[i].path);
+        if ((player[i + 1] == NULL) || (pip_add(player[i + 1], pip[i].x0, pip[i].y0, LCD_COL_TRUE, 1) < 0))
+        {
+            DEBUG_ERR(ecode, "PiP Player [%s] Init Error!", pip[i].path);
+            ecode = 2;
+            goto error;
+        }
+    }
+
+    while (loop_times--)
+    {
+        for (i = 0; i <= pip_num; i++)
+        {
+            bmp_player_start(player[i]);
+        }
+        pip_run();
+    }
+
+error:
+    pip_clear();
+    for (i = 0; i <= pip_num; i++)
+    {
+        if (player[i] != NULL)
+        {
+            bmp_player_close(player[i]);
+        }
+    }
+    lcd_clear(LCD_COL_FALSE);
+    return ecode;
+}
+
+/*
+ * play_control:
+ *	用事件循环播放, 播放期间从控制FIFO接收命令.
+ */
+static int play_control(char *movie_path, int start_ms, int end_ms, int loop_times, int view_x, int view_y, char *fifo)
+{
+    bmp_player_t *player = NULL;
+    int ecode = 0;
+
+    player = bmp_player_open((int8_t *)movie_path);
+    if ((player == NULL) || (((start_ms > 0) || (end_ms >= 0)) && (bmp_player_set_range_ms(player, start_ms, end_ms) != OK)))
+    {
+        DEBUG_ERR(ecode, "Movie Player Init Error!");
+        ecode = 2;
+        goto error;
+    }
+    bmp_player_set_view(player, view_x, view_y);
+
+    if (evloop_init(player, bmp_player_center_x(player), 0, LCD_COL_TRUE, fifo) != OK)
+    {
+        DEBUG_ERR(ecode, "Control Fifo [%s] Init Error!", fifo);
+        ecode = 2;
+        goto error;
+    }
+
+    while (loop_times--)
+    {
+        bmp_player_start(player);
+        evloop_run();
+        if (player->ctrl != LCD_CTRL_STOP)
+        {
+            break; // quit
+        }
+    }
+    evloop_dinit();
+
+error:
+    if (player != NULL)
+    {
+        bmp_player_close(player);
+    }
+    lcd_clear(LCD_COL_FALSE);
+    return ecode;
+}
+
+/*
+ * play_rate:
+ *	按显示帧率播放, 屏幕跟不上视频帧率时均匀丢帧, 总时长不变.
+ */
+static int play_rate(char *movie_path, int start_ms, int end_ms, int loop_times, int view_x, int view_y, int disp_fps)
+{
+    bmp_player_t *player = NULL;
+    int ecode = 0;
+
+    player = bmp_player_open((int8_t *)movie_path);
+    if ((player == NULL) || (((start_ms > 0) || (end_ms >= 0)) && (bmp_player_set_range_ms(player, start_ms, end_ms) != OK)))
+    {
+        DEBUG_ERR(ecode, "Movie Player Init Error!");
+        ecode = 2;
+        goto error;
+    }
+    bmp_player_set_view(player, view_x, view_y);
+
+    if (disp_fps <= 0)
+    {
+        disp_fps = rate_choose(player->hdr.video_fps, rate_calibrate(bmp_player_center_x(player), 0,
+                                                                     player->hdr.lcd_width, player->hdr.lcd_height));
+    }
+
+    while (loop_times--)
+    {
+        rate_play(player, bmp_player_center_x(player), 0, LCD_COL_TRUE, disp_fps);
+    }
+
+error:
+    if (player != NULL)
+    {
+        bmp_player_close(player);
+    }
+    lcd_clear(LCD_COL_FALSE);
+    return ecode;
+}
+
 int main(int argc, char **argv)
 {
     int ecode = 0;
@@ -28,15 +204,41 @@ int main(int argc, char **argv)
     int option_index = 0;
     char movie_path[LCD_MOVIE_NAME_LEN + 1] = {0};
     int loop_times = 1;
+    int start_ms = 0, end_ms = -1;
+    int stream_width = LCD_MAX_X, stream_height = LCD_MAX_Y;
+    int stream_drop = 0;
+    dither_mode_t stream_dither = DITHER_NONE;
+    int frc_cycle = 0, frc_rate = 0;
+    lcd_frc_stat_t frc_stat = {0};
+    pip_arg_t pip[PIP_CLIP_MAX - 1];
+    int pip_num = 0;
+    char *control_fifo = NULL;
+    int level[LCD_COL_MAX] = {0};
+    uint8_t level_map[LCD_COL_MAX] = {0, 1, 2, 3};
+    int level_set = 0;
+    int disp_fps = -1;
+    int view_x = 0, view_y = 0;
     static struct option long_options[] =
     {
         {"help", no_argument, 0, 'h'},
         {"file", required_argument, 0, 'f'},
         {"loop", required_argument, 0, 'l'},
+        {"start", required_argument, 0, 's'},
+        {"end", required_argument, 0, 'e'},
+        {"size", required_argument, 0, 'S'},
+        {"drop", no_argument, 0, 'D'},
+        {"dither", required_argument, 0, 'd'},
+        {"frc", required_argument, 0, 'F'},
+        {"pip", required_argument, 0, 'p'},
+        {"list", required_argument, 0, 'L'},
+        {"control", required_argument, 0, 'c'},
+        {"levels", required_argument, 0, 'g'},
+        {"rate", required_argument, 0, 'R'},
+        {"view", required_argument, 0, 'V'},
         {0, 0, 0, 0}
     };
 
-    while ((opt = getopt_long(argc, argv, "f:l:h", long_options, &option_index)) != -1)
+    while ((opt = getopt_long(argc, argv, "f:l:s:e:S:Dd:F:p:L:c:g:R:V:h", long_options, &option_index)) != -1)
     {
         opt_num++;
         switch (opt)
@@ -58,11 +260,60 @@ int main(int argc, char **argv)
             }
             break;
         case 'f':
-            strncpy(movie_path, optarg, LCD_MOVIE_NAME_LEN);
+            if (strlen(movie_path) == 0)
+                strncpy(movie_path, optarg, LCD_MOVIE_NAME_LEN);
+            playlist_add(optarg);
             break;
         case 'l':
             loop_times = atoi(optarg);
             break;
+        case 's':
+            start_ms = atoi(optarg);
+            break;
+        case 'e':
+            end_ms = atoi(optarg);
+            break;
+        case 'S':
+            sscanf(optarg, "%dx%d", &stream_width, &stream_height);
+            break;
+        case 'D':
+            stream_drop = 1;
+            break;
+        case 'd':
+            stream_dither = dither_mode_from_name(optarg);
+            break;
+        case 'F':
+            sscanf(optarg, "%d@%d", &frc_cycle, &frc_rate);
+            break;
+        case 'p':
+            if ((pip_num >= (PIP_CLIP_MAX - 1)) || (parse_pip(optarg, &pip[pip_num]) != OK))
+            {
+                print_usage(argv[0]);
+                ecode = 1;
+                goto error;
+            }
+            pip_num++;
+            break;
+        case 'L':
+            if (playlist_load(optarg) < 0)
+            {
+                DEBUG_ERR(ecode, "Invalid list file!");
+                ecode = 1;
+                goto error;
+            }
+            break;
+        case 'c':
+            control_fifo = optarg;
+            break;
+        case 'g':
+            level_set = sscanf(optarg, "%d,%d,%d,%d", &level[0], &level[1], &level[2], &level[3]);
+            break;
+        case 'R':
+            disp_fps = (strcmp(optarg, "auto") == 0) ? 0 : atoi(optarg);
+            break;
+        case 'V':
+            sscanf(optarg, "%d,%d", &view_x, &view_y);
+            break;
         case 'h':
         default:
             print_usage(argv[0]);
@@ -79,7 +330,7 @@ int main(int argc, char **argv)
         goto error;
     }
 
-    if (strlen(movie_path) == 0)
+    if ((strlen(movie_path) == 0) && (playlist_count() == 0))
     {
         DEBUG_ERR(ecode, "Invalid file path!");
         print_usage(argv[0]);
@@ -95,9 +346,126 @@ int main(int argc, char **argv)
         goto error;
     }
 
+    if (level_set != 0)
+    {
+        for (opt = 0; (level_set == LCD_COL_MAX) && (opt < LCD_COL_MAX); opt++)
+        {
+            level_set = ((level[opt] >= 0) && (level[opt] < LCD_COL_MAX)) ? level_set : 0;
+            level_map[opt] = (uint8_t)level[opt];
+        }
+        if ((level_set != LCD_COL_MAX) || (lcd_set_level_map(level_map) != OK))
+        {
+            DEBUG_ERR(ecode, "Invalid gray level map!");
+            print_usage(argv[0]);
+            ecode = 1;
+            goto error;
+        }
+    }
+
+    if ((start_ms < 0) || ((end_ms >= 0) && (end_ms < start_ms)))
+    {
+        DEBUG_ERR(ecode, "Invalid play range!");
+        print_usage(argv[0]);
+        ecode = 1;
+        goto error;
+    }
+
+    if (strcmp(movie_path, "-") == 0)
+    {
+        if ((stream_width <= 0) || (stream_width > LCD_MAX_X) || (stream_height <= 0) || (stream_height > LCD_MAX_Y))
+        {
+            DEBUG_ERR(ecode, "Invalid stream size!");
+            print_usage(argv[0]);
+            ecode = 1;
+            goto error;
+        }
+
+        if (stream_dither >= DITHER_MAX)
+        {
+            DEBUG_ERR(ecode, "Invalid dither mode!");
+            print_usage(argv[0]);
+            ecode = 1;
+            goto error;
+        }
+
+        if ((frc_cycle != 0) && ((frc_cycle < FRC_CYCLE_MIN) || (frc_cycle > FRC_CYCLE_MAX) || (frc_rate < 0)))
+        {
+            DEBUG_ERR(ecode, "Invalid frc mode!");
+            print_usage(argv[0]);
+            ecode = 1;
+            goto error;
+        }
+
+        DEBUG_LOG("Play Stream [%dx%d] From Stdin.", stream_width, stream_height);
+
+        lcd_init();
+        stream_set_dither(stream_dither);
+        if (frc_cycle != 0)
+        {
+            if (frc_init((LCD_MAX_X - stream_width) / 2, 0, stream_width, stream_height, frc_cycle, frc_rate) != OK)
+            {
+                DEBUG_ERR(ecode, "FRC Init Error!");
+                ecode = 2;
+                goto error;
+            }
+            stream_set_frc(1);
+        }
+        if (stream_init(STDIN_FILENO, stream_width, stream_height, STREAM_DEPTH_DEFAULT, stream_drop) != OK)
+        {
+            DEBUG_ERR(ecode, "Stream Player Init Error!");
+            ecode = 2;
+            goto error;
+        }
+        while (stream_show((LCD_MAX_X - stream_width) / 2, 0, LCD_COL_TRUE) != LCD_CTRL_STOP);
+        stream_dinit();
+        if (frc_cycle != 0)
+        {
+            frc_get_stat(&frc_stat);
+            DEBUG_LOG("FRC Rate [%u.%03u]Hz Late [%u].", frc_stat.rate_mhz / 1000, frc_stat.rate_mhz % 1000, frc_stat.late);
+            frc_dinit();
+        }
+        DEBUG_LOG("Play Stream End.");
+        ecode = 0;
+        goto error;
+    }
+
+    if ((playlist_count() > 1) || (strlen(movie_path) == 0))
+    {
+        DEBUG_LOG("Play List [%d] Movies Loop Times [%d].", playlist_count(), loop_times);
+        lcd_init();
+        playlist_set_range_ms(start_ms, end_ms);
+        playlist_set_view(view_x, view_y);
+        ecode = (playlist_play(loop_times, LCD_COL_TRUE) == OK) ? 0 : 2;
+        playlist_clear();
+        lcd_clear(LCD_COL_FALSE);
+        DEBUG_LOG("Play List End.");
+        goto error;
+    }
+
     DEBUG_LOG("Play Movie [%s] Loop Times [%d].", movie_path, loop_times);
 
     lcd_init();
+    if (pip_num > 0)
+    {
+        ecode = play_pip(movie_path, start_ms, end_ms, loop_times, view_x, view_y, pip, pip_num);
+        DEBUG_LOG("Play Movie [%s] End.", movie_path);
+        goto error;
+    }
+
+    if (disp_fps >= 0)
+    {
+        ecode = play_rate(movie_path, start_ms, end_ms, loop_times, view_x, view_y, disp_fps);
+        DEBUG_LOG("Play Movie [%s] End.", movie_path);
+        goto error;
+    }
+
+    if (control_fifo != NULL)
+    {
+        ecode = play_control(movie_path, start_ms, end_ms, loop_times, view_x, view_y, control_fifo);
+        DEBUG_LOG("Play Movie [%s] End.", movie_path);
+        goto error;
+    }
+
     ecode = bmp_init(movie_path);
     if (ecode != OK)
     {
@@ -105,6 +473,17 @@ int main(int argc, char **argv)
         ecode = 2;
         goto error;
     }
+    if ((start_ms > 0) || (end_ms >= 0))
+    {
+        if (bmp_set_range_ms(start_ms, end_ms) != OK)
+        {
+            DEBUG_ERR(ecode, "Invalid play range!");
+            bmp_dinit();
+            ecode = 2;
+            goto error;
+        }
+    }
+    bmp_set_view(view_x, view_y);
     bmp_start();
     while (loop_times--)
     {
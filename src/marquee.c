@@ -0,0 +1,239 @@
+#include "marquee.h"
+#include "lcd.h"
+#include <time.h>
+#include <pthread.h>
+
+typedef struct lcd_marquee_s
+{
+    int32_t used;
+    int32_t x0;        //可视区域 [x0, x1)
+    int32_t x1;
+    int32_t y;
+    int32_t bcolor;
+    int32_t fcolor;
+    int32_t font;      //添加时的字体
+    int8_t text[MARQUEE_TEXT_LEN + 1];
+    int32_t text_w;    //文字宽度(像素)
+    int32_t period;    //文字宽度加一个区域宽的空白, 偏移按此循环
+    int32_t offset;    //区域左边第一列对应的文字列
+    int32_t step;
+    uint32_t period_ms;
+    uint32_t due;      //下一次移动的时间(ms)
+} lcd_marquee_t;
+
+static lcd_marquee_t MARQUEE[MARQUEE_MAX];
+static pthread_mutex_t MARQUEE_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+static uint32_t marquee_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/*
+ * marquee_render:
+ *	画可视区域的 [c0, c1) 列, 每列对应的文字列为 (c - x0 + offset) % period,
+ *	在循环点处分段. 调用者持有 lcd_lock 并已切换到跑马灯的字体.
+ */
+static void marquee_render(lcd_marquee_t *m, int32_t c0, int32_t c1)
+{
+    font_t *pfont = lcd_get_font();
+    int32_t c = c0, k = 0, n = 0;
+
+    while (c < c1)
+    {
+        k = (c - m->x0 + m->offset) % m->period;
+        if (k >= m->text_w)
+        {
+            //文字后面的空白
+            n = m->period - k;
+            n = (n > (c1 - c)) ? (c1 - c) : n;
+            lcd_rectangle(c, m->y, c + n - 1, m->y + pfont->height - 1, m->bcolor, 1);
+        }
+        else
+        {
+            n = pfont->width - (k % pfont->width);
+            n = (n > (c1 - c)) ? (c1 - c) : n;
+            lcd_putc_s(c - (k % pfont->width), c, c + n - 1, m->y, m->text[k / pfont->width], m->bcolor, m->fcolor);
+        }
+        c += n;
+    }
+}
+
+/*
+ * marquee_advance:
+ *	移动 d 列(正数向左). 区域内的图像整体平移, 只画新露出的列;
+ *	移动超过区域宽度时整个区域重画.
+ */
+static void marquee_advance(lcd_marquee_t *m, int32_t d)
+{
+    font_t *pfont = lcd_get_font();
+    int32_t width = m->x1 - m->x0;
+
+    m->offset = ((m->offset + d) % m->period + m->period) % m->period;
+    if ((d >= width) || (d <= -width))
+    {
+        marquee_render(m, m->x0, m->x1);
+        return;
+    }
+
+    lcd_hshift(m->x0, m->y, width, pfont->height, -d);
+    if (d > 0)
+    {
+        marquee_render(m, m->x1 - d, m->x1);
+    }
+    else
+    {
+        marquee_render(m, m->x0, m->x0 - d);
+    }
+}
+
+static void marquee_reset(lcd_marquee_t *m, int8_t *str)
+{
+    font_t *pfont = lcd_get_font();
+
+    strncpy((char *)m->text, (char *)str, MARQUEE_TEXT_LEN);
+    m->text[MARQUEE_TEXT_LEN] = '\0';
+    m->text_w = (int32_t)strlen((char *)m->text) * pfont->width;
+    m->period = m->text_w + (m->x1 - m->x0);
+    m->offset = 0;
+    m->due = marquee_now_ms() + m->period_ms;
+    marquee_render(m, m->x0, m->x1);
+}
+
+int32_t marquee_add(int32_t x0, int32_t x1, int32_t y, int8_t *str, int32_t bcolor, int32_t fcolor,
+                    int32_t step, int32_t period_ms)
+{
+    lcd_marquee_t *m = NULL;
+    int32_t id = 0;
+
+    x0 = (x0 < 0) ? 0 : x0;
+    x1 = (x1 > LCD_MAX_X) ? LCD_MAX_X : x1;
+    if ((str == NULL) || (x0 >= x1) || (y < 0) || (y >= LCD_MAX_Y) || (step == 0) || (period_ms <= 0))
+    {
+        return ERROR;
+    }
+
+    pthread_mutex_lock(&MARQUEE_LOCK);
+    for (id = 0; (id < MARQUEE_MAX) && MARQUEE[id].used; id++);
+    if (id >= MARQUEE_MAX)
+    {
+        pthread_mutex_unlock(&MARQUEE_LOCK);
+        return ERROR;
+    }
+
+    m = &MARQUEE[id];
+    memset(m, 0, sizeof(lcd_marquee_t));
+    m->used = 1;
+    m->x0 = x0;
+    m->x1 = x1;
+    m->y = y;
+    m->bcolor = bcolor;
+    m->fcolor = fcolor;
+    m->step = step;
+    m->period_ms = (uint32_t)period_ms;
+
+    lcd_lock();
+    m->font = lcd_get_font()->name;
+    marquee_reset(m, str);
+    lcd_unlock();
+    pthread_mutex_unlock(&MARQUEE_LOCK);
+
+    return id;
+}
+
+int32_t marquee_set_text(int32_t id, int8_t *str)
+{
+    font_t *pfont = NULL;
+
+    if ((id < 0) || (id >= MARQUEE_MAX) || (str == NULL))
+    {
+        return ERROR;
+    }
+
+    pthread_mutex_lock(&MARQUEE_LOCK);
+    if (!MARQUEE[id].used)
+    {
+        pthread_mutex_unlock(&MARQUEE_LOCK);
+        return ERROR;
+    }
+
+    lcd_lock();
+    pfont = lcd_get_font();
+    lcd_set_font(MARQUEE[id].font);
+    marquee_reset(&MARQUEE[id], str);
+    lcd_set_font(pfont->name);
+    lcd_unlock();
+    pthread_mutex_unlock(&MARQUEE_LOCK);
+
+    return OK;
+}
+
+int32_t marquee_remove(int32_t id)
+{
+    if ((id < 0) || (id >= MARQUEE_MAX))
+    {
+        return ERROR;
+    }
+
+    pthread_mutex_lock(&MARQUEE_LOCK);
+    MARQUEE[id].used = 0;
+    pthread_mutex_unlock(&MARQUEE_LOCK);
+
+    return OK;
+}
+
+int32_t marquee_clear(void)
+{
+    pthread_mutex_lock(&MARQUEE_LOCK);
+    memset(MARQUEE, 0, sizeof(MARQUEE));
+    pthread_mutex_unlock(&MARQUEE_LOCK);
+
+    return OK;
+}
+
+int32_t marquee_tick(void)
+{
+    lcd_marquee_t *m = NULL;
+    font_t *pfont = NULL;
+    uint32_t now = marquee_now_ms();
+    uint32_t k = 0;
+    int32_t id = 0, moved = 0;
+    int32_t wait = 0, next = ERROR;
+
+    pthread_mutex_lock(&MARQUEE_LOCK);
+    lcd_lock();
+    pfont = lcd_get_font();
+    for (id = 0; id < MARQUEE_MAX; id++)
+    {
+        m = &MARQUEE[id];
+        if (!m->used)
+        {
+            continue;
+        }
+
+        if ((int32_t)(now - m->due) >= 0)
+        {
+            //晚了几个周期就一次移动几步
+            k = 1 + (now - m->due) / m->period_ms;
+            m->due += k * m->period_ms;
+            lcd_set_font(m->font);
+            marquee_advance(m, m->step * (int32_t)k);
+            moved = 1;
+        }
+
+        wait = (int32_t)(m->due - now);
+        next = ((next == ERROR) || (wait < next)) ? wait : next;
+    }
+    lcd_set_font(pfont->name);
+
+    if (moved)
+    {
+        lcd_flush();
+    }
+    lcd_unlock();
+    pthread_mutex_unlock(&MARQUEE_LOCK);
+
+    return next;
+}
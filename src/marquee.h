@@ -0,0 +1,48 @@
+#ifndef _LCD_MARQUEE_H_
+#define _LCD_MARQUEE_H_
+
+#include "type.h"
+
+#define MARQUEE_MAX (8)
+#define MARQUEE_TEXT_LEN (255)
+
+/*****************************************************************************
+函 数 名  : marquee_add
+功能描述  : 添加一个跑马灯, 文字在 [x0, x1) 列之间循环移动, 末尾留一个区域宽的
+            空白后重新进入. 只画第一屏到显存, 之后由 marquee_tick 推进
+输入参数  : x0, x1          可视区域的起止列
+            y               文字的y坐标
+            str             文字, 使用添加时的字体
+            bcolor, fcolor  背景色和前景色
+            step            每次移动的列数, 正数向左, 负数向右
+            period_ms       移动周期(ms)
+输出参数  : 无
+返 回 值  : 跑马灯编号, 失败返回 ERROR
+*****************************************************************************/
+extern int32_t marquee_add(int32_t x0, int32_t x1, int32_t y, int8_t *str, int32_t bcolor, int32_t fcolor,
+                           int32_t step, int32_t period_ms);
+
+/*****************************************************************************
+函 数 名  : marquee_set_text
+功能描述  : 更换跑马灯的文字, 从头开始显示
+输入参数  : id   跑马灯编号
+            str  文字
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t marquee_set_text(int32_t id, int8_t *str);
+extern int32_t marquee_remove(int32_t id);
+extern int32_t marquee_clear(void);
+
+/*****************************************************************************
+函 数 名  : marquee_tick
+功能描述  : 推进所有到期的跑马灯, 不阻塞: 每个跑马灯把可视区域内的图像平移,
+            只画新露出的列, 然后一次 lcd_flush 只发送这些区域. 晚了几个周期
+            时一次移动对应的列数. 可在任意线程中调用, 例如视频播放循环里
+输入参数  : 无
+输出参数  : 无
+返 回 值  : 距离下一个跑马灯到期的毫秒数, 没有跑马灯时返回 ERROR
+*****************************************************************************/
+extern int32_t marquee_tick(void);
+
+#endif
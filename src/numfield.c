@@ -0,0 +1,137 @@
+#include "numfield.h"
+#include "lcd.h"
+#include "strip.h"
+
+/*
+ * numfield_format:
+ *	把定点数格式化为 width 个字符, 右对齐; 放不下时全部为 '-'.
+ */
+static void numfield_format(const lcd_numfield_t *nf, int32_t value, int8_t *text)
+{
+    char buff[32] = {0};
+    int64_t v = (value < 0) ? -(int64_t)value : value;
+    int64_t scale = 1;
+    int32_t i = 0, len = 0;
+
+    for (i = 0; i < nf->decimals; i++)
+    {
+        scale *= 10;
+    }
+
+    if (nf->decimals > 0)
+    {
+        len = snprintf(buff, sizeof(buff), "%s%lld.%0*lld", (value < 0) ? "-" : "", (long long)(v / scale),
+                       (int)nf->decimals, (long long)(v % scale));
+    }
+    else
+    {
+        len = snprintf(buff, sizeof(buff), "%d", value);
+    }
+
+    if ((len < 0) || (len > nf->width))
+    {
+        memset(text, '-', nf->width);
+    }
+    else
+    {
+        memset(text, ' ', nf->width - len);
+        memcpy(text + nf->width - len, buff, len);
+    }
+    text[nf->width] = '\0';
+}
+
+lcd_numfield_t *numfield_create(int32_t x, int32_t y, int32_t width, int32_t decimals, int32_t bcolor, int32_t fcolor)
+{
+    lcd_numfield_t *nf = NULL;
+    font_t *pfont = lcd_get_font();
+    int32_t phase = 0, pages = 0;
+
+    if ((width < 1) || (width > NUMFIELD_WIDTH_MAX) || (decimals < 0) || (decimals > 9))
+    {
+        return NULL;
+    }
+
+    nf = (lcd_numfield_t *)calloc(1, sizeof(lcd_numfield_t));
+    if (nf == NULL)
+    {
+        DEBUG_ERR(ERROR, "numfield malloc failed");
+        return NULL;
+    }
+
+    nf->x = x;
+    nf->y = y;
+    nf->width = width;
+    nf->decimals = decimals;
+    nf->font = pfont->name;
+    nf->cell_w = pfont->width;
+    nf->cell_h = pfont->height;
+
+    //字符集按 y 的页内偏移渲染一次, 之后每个字符都是整字节拷贝
+    phase = ((y % LCD_DRV_PAGE_ROW) + LCD_DRV_PAGE_ROW) % LCD_DRV_PAGE_ROW;
+    pages = (phase + pfont->height + LCD_DRV_PAGE_ROW - 1) / LCD_DRV_PAGE_ROW;
+    nf->stride = (int32_t)strlen(NUMFIELD_CHARSET) * pfont->width;
+    nf->glyph = (uint8_t *)calloc(pages, nf->stride);
+    if (nf->glyph == NULL)
+    {
+        DEBUG_ERR(ERROR, "numfield malloc failed");
+        free(nf);
+        return NULL;
+    }
+    strip_render(nf->glyph, nf->stride, phase, (const int8_t *)NUMFIELD_CHARSET, bcolor, fcolor);
+
+    return nf;
+}
+
+int32_t numfield_destroy(lcd_numfield_t *nf)
+{
+    if (nf == NULL)
+    {
+        return ERROR;
+    }
+
+    free(nf->glyph);
+    free(nf);
+    return OK;
+}
+
+int32_t numfield_set(lcd_numfield_t *nf, int32_t value)
+{
+    int8_t text[NUMFIELD_WIDTH_MAX + 1];
+    int32_t i = 0, k = 0, drawn = 0;
+
+    if (nf == NULL)
+    {
+        return ERROR;
+    }
+
+    numfield_format(nf, value, text);
+
+    lcd_lock();
+    for (i = 0; i < nf->width; i++)
+    {
+        if (nf->valid && (text[i] == nf->shown[i]))
+        {
+            continue;
+        }
+
+        k = (int32_t)(strchr(NUMFIELD_CHARSET, text[i]) - NUMFIELD_CHARSET);
+        lcd_drv_blit_strip(nf->x + i * nf->cell_w, nf->y, nf->cell_w, nf->cell_h, nf->glyph, nf->stride, k * nf->cell_w);
+        nf->shown[i] = text[i];
+        drawn++;
+    }
+    nf->valid = 1;
+    lcd_unlock();
+
+    return drawn;
+}
+
+int32_t numfield_redraw(lcd_numfield_t *nf)
+{
+    if (nf == NULL)
+    {
+        return ERROR;
+    }
+
+    nf->valid = 0;
+    return OK;
+}
@@ -0,0 +1,62 @@
+#ifndef _LCD_NUMFIELD_H_
+#define _LCD_NUMFIELD_H_
+
+#include "type.h"
+
+#define NUMFIELD_WIDTH_MAX (16)
+#define NUMFIELD_CHARSET " -.0123456789"
+
+/*
+ * 固定格式的数字显示区: width 个字符右对齐, decimals 位小数.
+ * 字符集 NUMFIELD_CHARSET 在创建时按显示位置的页内偏移渲染成页格式条带,
+ * 更新时只把与上次不同的字符从条带按字节拷贝到显存.
+ */
+typedef struct lcd_numfield_s
+{
+    int32_t x;
+    int32_t y;
+    int32_t width;        //字符数
+    int32_t decimals;     //小数位数
+    int32_t font;         //创建时的字体
+    int32_t cell_w;       //字符宽度(像素)
+    int32_t cell_h;
+    int32_t stride;       //字符集条带每页的字节数
+    uint8_t *glyph;       //字符集条带
+    int8_t shown[NUMFIELD_WIDTH_MAX + 1]; //显存中现在的字符
+    int32_t valid;        //shown 是否与显存一致
+} lcd_numfield_t;
+
+/*****************************************************************************
+函 数 名  : numfield_create
+功能描述  : 创建一个数字显示区, 使用当前字体, 不画任何内容
+输入参数  : x, y            左上角位置
+            width           字符数(含符号和小数点), 1 - NUMFIELD_WIDTH_MAX
+            decimals        小数位数
+            bcolor, fcolor  背景色和前景色
+输出参数  : 无
+返 回 值  : 数字显示区, 失败返回NULL
+*****************************************************************************/
+extern lcd_numfield_t *numfield_create(int32_t x, int32_t y, int32_t width, int32_t decimals, int32_t bcolor, int32_t fcolor);
+extern int32_t numfield_destroy(lcd_numfield_t *nf);
+
+/*****************************************************************************
+函 数 名  : numfield_set
+功能描述  : 显示一个数值(只写入显存并标记脏区域, 不更新硬件), 只有变化的字符
+            被重画. 放不下时整个区域显示 '-'
+输入参数  : nf     数字显示区
+            value  放大 10^decimals 倍的整数, 如 decimals 为2时 -1234 显示为 -12.34
+输出参数  : 无
+返 回 值  : 重画的字符数, 失败返回 ERROR
+*****************************************************************************/
+extern int32_t numfield_set(lcd_numfield_t *nf, int32_t value);
+
+/*****************************************************************************
+函 数 名  : numfield_redraw
+功能描述  : 下一次 numfield_set 重画所有字符, 用于显存被其它内容覆盖之后
+输入参数  : nf  数字显示区
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t numfield_redraw(lcd_numfield_t *nf);
+
+#endif
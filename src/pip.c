@@ -0,0 +1,215 @@
+#include "pip.h"
+#include "lcd.h"
+#include <time.h>
+#include <errno.h>
+
+typedef struct lcd_pip_clip_s
+{
+    bmp_player_t *player;
+    int32_t x0;
+    int32_t y0;
+    int32_t colour;
+    int32_t loop;
+    int32_t done;      //不循环的区域已播放完毕
+    int64_t period_us; //帧周期
+    int64_t due_us;    //下一帧的预定时间
+} lcd_pip_clip_t;
+
+static lcd_pip_clip_t PIP_CLIP[PIP_CLIP_MAX];
+static int32_t PIP_CLIP_NUM = 0;
+static int64_t PIP_COALESCE_US = PIP_COALESCE_US_DEFAULT;
+static volatile int32_t PIP_RUN = 0;
+static lcd_pip_stat_t PIP_STAT = {0};
+
+static int64_t pip_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void pip_sleep_until(int64_t t_us)
+{
+    struct timespec ts;
+
+    ts.tv_sec = t_us / 1000000;
+    ts.tv_nsec = (t_us % 1000000) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+}
+
+int32_t pip_add(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour, int32_t loop)
+{
+    lcd_pip_clip_t *clip = NULL;
+
+    if ((player == NULL) || (PIP_CLIP_NUM >= PIP_CLIP_MAX) || PIP_RUN)
+    {
+        return ERROR;
+    }
+
+    clip = &PIP_CLIP[PIP_CLIP_NUM];
+    memset(clip, 0, sizeof(lcd_pip_clip_t));
+    clip->player = player;
+    clip->x0 = x0;
+    clip->y0 = y0;
+    clip->colour = colour;
+    clip->loop = loop;
+    clip->period_us = 1000000 / player->hdr.video_fps;
+
+    return PIP_CLIP_NUM++;
+}
+
+int32_t pip_set_coalesce(int32_t us)
+{
+    if (us < 0)
+    {
+        return ERROR;
+    }
+
+    PIP_COALESCE_US = us;
+    return OK;
+}
+
+/*
+ * pip_decode:
+ *	Read the next frame of a clip into the framebuffer, restarting
+ *	looping clips. Returns ERROR once a non-looping clip is finished.
+ */
+static int32_t pip_decode(lcd_pip_clip_t *clip)
+{
+    bmp_player_t *player = clip->player;
+
+    if (bmp_player_next(player) != OK)
+    {
+        if (!clip->loop)
+        {
+            return ERROR;
+        }
+        bmp_player_start(player);
+        if (bmp_player_next(player) != OK)
+        {
+            return ERROR;
+        }
+    }
+
+    if (!clip->loop && (player->ctrl == LCD_CTRL_STOP))
+    {
+        //最后一帧照常显示, 之后不再调度
+        clip->done = 1;
+    }
+
+    return bmp_player_blit(player, clip->x0, clip->y0, clip->colour);
+}
+
+int32_t pip_run(void)
+{
+    lcd_pip_clip_t *clip = NULL;
+    int64_t t0 = 0, now = 0, due = 0;
+    int32_t i = 0, active = 0, waiting = 0, once = 0, shown = 0;
+
+    if (PIP_CLIP_NUM == 0)
+    {
+        return ERROR;
+    }
+
+    memset(&PIP_STAT, 0, sizeof(PIP_STAT));
+    t0 = pip_now_us();
+    for (i = 0; i < PIP_CLIP_NUM; i++)
+    {
+        PIP_CLIP[i].due_us = t0;
+        PIP_CLIP[i].done = 0;
+        once += PIP_CLIP[i].loop ? 0 : 1;
+    }
+
+    PIP_RUN = 1;
+    while (PIP_RUN)
+    {
+        //最早到期的区域决定下一次刷新的时间
+        active = 0;
+        waiting = 0;
+        for (i = 0; i < PIP_CLIP_NUM; i++)
+        {
+            clip = &PIP_CLIP[i];
+            if (clip->done)
+                continue;
+            due = ((waiting == 0) || (clip->due_us < due)) ? clip->due_us : due;
+            waiting++;
+            active += clip->loop ? 0 : 1;
+        }
+        //不循环的区域都播完后结束, 全部循环时由 pip_stop 结束
+        if ((waiting == 0) || (once && (active == 0)))
+        {
+            break;
+        }
+
+        pip_sleep_until(due);
+        now = pip_now_us();
+
+        //窗口内到期的区域一起解码, 合成一次刷新
+        shown = 0;
+        lcd_lock();
+        for (i = 0; i < PIP_CLIP_NUM; i++)
+        {
+            clip = &PIP_CLIP[i];
+            if (clip->done || (clip->due_us > (due + PIP_COALESCE_US)))
+                continue;
+
+            if (pip_decode(clip) == OK)
+            {
+                shown++;
+            }
+            else
+            {
+                clip->done = 1;
+            }
+
+            //按预定时间推进, 不累积误差; 落后超过一帧则重新对齐
+            clip->due_us += clip->period_us;
+            if (clip->due_us < now)
+            {
+                clip->due_us = now + clip->period_us;
+                PIP_STAT.late++;
+            }
+        }
+        if (shown > 0)
+        {
+            lcd_flush();
+            PIP_STAT.frames += shown;
+            PIP_STAT.flushes++;
+        }
+        lcd_unlock();
+    }
+    PIP_RUN = 0;
+
+    DEBUG_LOG("PiP frames [%u] flushes [%u] late [%u].", PIP_STAT.frames, PIP_STAT.flushes, PIP_STAT.late);
+
+    return OK;
+}
+
+int32_t pip_stop(void)
+{
+    PIP_RUN = 0;
+    return OK;
+}
+
+int32_t pip_clear(void)
+{
+    if (PIP_RUN)
+    {
+        return ERROR;
+    }
+
+    memset(PIP_CLIP, 0, sizeof(PIP_CLIP));
+    PIP_CLIP_NUM = 0;
+    return OK;
+}
+
+int32_t pip_get_stat(lcd_pip_stat_t *stat)
+{
+    if (stat == NULL)
+    {
+        return ERROR;
+    }
+
+    *stat = PIP_STAT;
+    return OK;
+}
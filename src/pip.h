@@ -0,0 +1,53 @@
+#ifndef _LCD_PIP_H_
+#define _LCD_PIP_H_
+
+#include "type.h"
+#include "bmp.h"
+
+#define PIP_CLIP_MAX (4)
+#define PIP_COALESCE_US_DEFAULT (10000)
+
+typedef struct lcd_pip_stat_s
+{
+    uint32_t frames;  //所有区域显示的帧数之和
+    uint32_t flushes; //实际刷新次数
+    uint32_t late;    //比预定时间晚一个帧周期以上的刷新
+} lcd_pip_stat_t;
+
+/*****************************************************************************
+函 数 名  : pip_add
+功能描述  : 把一个已打开的播放器加入合成器, 按它自己的帧率播放到指定区域,
+            各区域不应重叠
+输入参数  : player  播放器句柄, 由调用者打开和关闭
+            x0, y0  区域左上角, y0 向下取整到页
+            colour  颜色(0-反色)
+            loop    1-播放结束后从头开始, 0-播放结束后停在最后一帧
+输出参数  : 无
+返 回 值  : 区域编号, 失败返回 ERROR
+*****************************************************************************/
+extern int32_t pip_add(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour, int32_t loop);
+
+/*****************************************************************************
+函 数 名  : pip_set_coalesce
+功能描述  : 设置合并窗口, 到期时间相差不超过窗口的区域提前一起刷新,
+            这样 24fps 和 25fps 两个区域不会按两者之和的频率刷新
+输入参数  : us  窗口(us), 默认 PIP_COALESCE_US_DEFAULT
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t pip_set_coalesce(int32_t us);
+
+/*****************************************************************************
+函 数 名  : pip_run
+功能描述  : 播放所有区域, 所有不循环的区域都播完(或 pip_stop)后返回.
+            每次刷新只发送本次更新过的区域
+输入参数  : 无
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t pip_run(void);
+extern int32_t pip_stop(void);
+extern int32_t pip_clear(void);
+extern int32_t pip_get_stat(lcd_pip_stat_t *stat);
+
+#endif
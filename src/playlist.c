@@ -0,0 +1,245 @@
+#include "playlist.h"
+#include "bmp.h"
+#include "lcd.h"
+#include <pthread.h>
+
+#define PLAYLIST_LINE_LEN (1024)
+
+typedef struct lcd_playlist_preload_s
+{
+    const char *filename;
+    bmp_player_t *player;
+    pthread_t thread;
+    int32_t running;
+} lcd_playlist_preload_t;
+
+static char *PLAYLIST_FILE[PLAYLIST_MAX] = {NULL};
+static int32_t PLAYLIST_NUM = 0;
+static int32_t PLAYLIST_FIRST_MS = 0;
+static int32_t PLAYLIST_LAST_MS = -1;
+static int32_t PLAYLIST_VIEW_X = 0;
+static int32_t PLAYLIST_VIEW_Y = 0;
+
+int32_t playlist_add(const char *filename)
+{
+    if ((filename == NULL) || (PLAYLIST_NUM >= PLAYLIST_MAX))
+    {
+        return ERROR;
+    }
+
+    PLAYLIST_FILE[PLAYLIST_NUM] = strdup(filename);
+    if (PLAYLIST_FILE[PLAYLIST_NUM] == NULL)
+    {
+        return ERROR;
+    }
+
+    PLAYLIST_NUM++;
+    return OK;
+}
+
+int32_t playlist_load(const char *listname)
+{
+    FILE *fp = NULL;
+    char line[PLAYLIST_LINE_LEN] = {0};
+    char *p = NULL, *e = NULL;
+    int32_t num = 0;
+
+    fp = fopen(listname, "r");
+    if (fp == NULL)
+    {
+        return ERROR;
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        for (p = line; (*p == ' ') || (*p == '\t'); p++);
+        for (e = p + strlen(p); (e > p) && ((e[-1] == '\n') || (e[-1] == '\r') || (e[-1] == ' ') || (e[-1] == '\t')); e--);
+        *e = '\0';
+        if ((*p == '\0') || (*p == '#'))
+        {
+            continue;
+        }
+
+        if (playlist_add(p) != OK)
+        {
+            fclose(fp);
+            return ERROR;
+        }
+        num++;
+    }
+
+    fclose(fp);
+    return num;
+}
+
+int32_t playlist_count(void)
+{
+    return PLAYLIST_NUM;
+}
+
+int32_t playlist_set_range_ms(int32_t first_ms, int32_t last_ms)
+{
+    PLAYLIST_FIRST_MS = first_ms;
+    PLAYLIST_LAST_MS = last_ms;
+    return OK;
+}
+
+int32_t playlist_set_view(int32_t vx, int32_t vy)
+{
+    PLAYLIST_VIEW_X = vx;
+    PLAYLIST_VIEW_Y = vy;
+    return OK;
+}
+
+int32_t playlist_clear(void)
+{
+    int32_t i = 0;
+
+    for (i = 0; i < PLAYLIST_NUM; i++)
+    {
+        free(PLAYLIST_FILE[i]);
+        PLAYLIST_FILE[i] = NULL;
+    }
+    PLAYLIST_NUM = 0;
+
+    return OK;
+}
+
+static bmp_player_t *playlist_open(const char *filename)
+{
+    bmp_player_t *player = NULL;
+
+    player = bmp_player_open((int8_t *)filename);
+    if (player == NULL)
+    {
+        DEBUG_LOG("Skip [%s], open error.", filename);
+        return NULL;
+    }
+
+    if (((PLAYLIST_FIRST_MS > 0) || (PLAYLIST_LAST_MS >= 0)) &&
+        (bmp_player_set_range_ms(player, PLAYLIST_FIRST_MS, PLAYLIST_LAST_MS) != OK))
+    {
+        DEBUG_LOG("Skip [%s], invalid play range.", filename);
+        bmp_player_close(player);
+        return NULL;
+    }
+    bmp_player_set_view(player, PLAYLIST_VIEW_X, PLAYLIST_VIEW_Y);
+
+    if (bmp_player_prefetch(player, PLAYLIST_PREFETCH_FRAMES) != OK)
+    {
+        DEBUG_LOG("Skip [%s], read error.", filename);
+        bmp_player_close(player);
+        return NULL;
+    }
+
+    return player;
+}
+
+static void *playlist_preloader(void *arg)
+{
+    lcd_playlist_preload_t *preload = (lcd_playlist_preload_t *)arg;
+
+    preload->player = playlist_open(preload->filename);
+    return NULL;
+}
+
+static void playlist_preload_start(lcd_playlist_preload_t *preload, const char *filename)
+{
+    preload->filename = filename;
+    preload->player = NULL;
+    preload->running = (pthread_create(&preload->thread, NULL, playlist_preloader, preload) == 0);
+    if (!preload->running)
+    {
+        //没有线程时退化为同步打开
+        preload->player = playlist_open(filename);
+    }
+}
+
+/*
+ * playlist_preload_wait:
+ *	等待预读结束并取走打开的视频, 由调用者关闭. 没有预读时返回 NULL.
+ */
+static bmp_player_t *playlist_preload_wait(lcd_playlist_preload_t *preload)
+{
+    bmp_player_t *player = NULL;
+
+    if (preload->running)
+    {
+        pthread_join(preload->thread, NULL);
+        preload->running = 0;
+    }
+
+    player = preload->player;
+    preload->player = NULL;
+    return player;
+}
+
+int32_t playlist_play(int32_t loop_times, int32_t colour)
+{
+    lcd_playlist_preload_t preload = {0};
+    bmp_player_t *cur = NULL, *next = NULL;
+    int64_t total = 0, i = 0;
+    int32_t x0 = 0, forever = 0;
+
+    if (PLAYLIST_NUM == 0)
+    {
+        return ERROR;
+    }
+
+    //与其他播放方式的 while (loop_times--) 相同: 0 不播放, 负数一直循环
+    if (loop_times == 0)
+    {
+        return OK;
+    }
+    forever = (loop_times < 0);
+    total = (int64_t)PLAYLIST_NUM * loop_times;
+
+    playlist_preload_start(&preload, PLAYLIST_FILE[0]);
+    for (i = 0; forever || (i < total); i++)
+    {
+        next = playlist_preload_wait(&preload);
+
+        //下一个视频在当前视频播放期间打开
+        if (forever || ((i + 1) < total))
+        {
+            playlist_preload_start(&preload, PLAYLIST_FILE[(i + 1) % PLAYLIST_NUM]);
+        }
+
+        if (next == NULL)
+        {
+            continue;
+        }
+
+        if (cur != NULL)
+        {
+            //第一帧沿用上一个视频的节拍; 尺寸不同时清掉旧画面, 随第一帧一起发送
+            next->tick = cur->tick;
+            if ((next->hdr.lcd_width != cur->hdr.lcd_width) || (next->hdr.lcd_height != cur->hdr.lcd_height))
+            {
+                lcd_lock();
+                lcd_clear(LCD_COL_FALSE);
+                lcd_unlock();
+            }
+            bmp_player_close(cur);
+        }
+        cur = next;
+
+        DEBUG_LOG("Playlist [%d/%d] [%s].", (int32_t)(i % PLAYLIST_NUM) + 1, PLAYLIST_NUM, PLAYLIST_FILE[i % PLAYLIST_NUM]);
+        x0 = bmp_player_center_x(cur);
+        while (bmp_player_step(cur, x0, 0, colour) != LCD_CTRL_STOP);
+    }
+
+    //不留下预读线程和它打开的视频
+    next = playlist_preload_wait(&preload);
+    if (next != NULL)
+    {
+        bmp_player_close(next);
+    }
+
+    if (cur != NULL)
+    {
+        bmp_player_close(cur);
+    }
+
+    return OK;
+}
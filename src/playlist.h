@@ -0,0 +1,44 @@
+#ifndef _LCD_PLAYLIST_H_
+#define _LCD_PLAYLIST_H_
+
+#include "type.h"
+
+#define PLAYLIST_MAX (64)
+#define PLAYLIST_PREFETCH_FRAMES (8)
+
+extern int32_t playlist_add(const char *filename);
+
+/*****************************************************************************
+函 数 名  : playlist_load
+功能描述  : 从列表文件添加视频, 每行一个路径, 空行和 # 开头的行被忽略
+输入参数  : listname  列表文件
+输出参数  : 无
+返 回 值  : 添加的个数, 失败返回 ERROR
+*****************************************************************************/
+extern int32_t playlist_load(const char *listname);
+extern int32_t playlist_count(void);
+extern int32_t playlist_set_range_ms(int32_t first_ms, int32_t last_ms);
+
+/*****************************************************************************
+函 数 名  : playlist_set_view
+功能描述  : 设置大于屏幕的视频的视口位置, 对之后打开的每个视频生效,
+            按各自的尺寸截断(见 bmp_player_set_view)
+输入参数  : vx, vy  视口左上角在视频中的位置
+输出参数  : 无
+返 回 值  : OK
+*****************************************************************************/
+extern int32_t playlist_set_view(int32_t vx, int32_t vy);
+
+/*****************************************************************************
+函 数 名  : playlist_play
+功能描述  : 按顺序无缝播放列表. 当前视频播放时, 后台线程打开下一个视频并预读
+            开头的帧, 切换时不清屏, 下一个视频的第一帧按上一帧的节拍显示
+输入参数  : loop_times  整个列表的播放次数
+            colour      颜色(0-反色)
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t playlist_play(int32_t loop_times, int32_t colour);
+extern int32_t playlist_clear(void);
+
+#endif
@@ -0,0 +1,318 @@
+#include "poly.h"
+#include "lcd.h"
+
+/*
+ * 边在第 y 行的交点用整数精确表示: 交点左边的像素中心满足
+ * x * POLY_SUB + POLY_SUB / 2 < M / d * POLY_SUB, 即 x < M / d,
+ * 记 M / d = q + r / d, 则第一个在交点右边的像素为 q + (r > 0).
+ * 每往下一行 M 增加固定的 POLY_SUB * dx, 分成 sq, sr 两部分累加, 没有误差.
+ */
+typedef struct poly_edge_s
+{
+    int32_t y0;       //第一行
+    int32_t y1;       //最后一行的下一行
+    int32_t dir;      //向下为1, 向上为-1
+    int32_t q;
+    int32_t r;        //[0, d)
+    int32_t d;
+    int32_t sq;       //每行 q, r 的增量
+    int32_t sr;
+} poly_edge_t;
+
+//sin(0 - 90 度), 放大 16384 倍
+static const int16_t POLY_SIN[91] =
+{
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+static int32_t POLY_CLIP_X0 = 0;
+static int32_t POLY_CLIP_Y0 = 0;
+static int32_t POLY_CLIP_X1 = LCD_MAX_X - 1;
+static int32_t POLY_CLIP_Y1 = LCD_MAX_Y - 1;
+
+static int32_t poly_ceil_div(int32_t n, int32_t d)
+{
+    return (n >= 0) ? ((n + d - 1) / d) : -((-n) / d);
+}
+
+static int64_t poly_floor_div(int64_t n, int64_t d)
+{
+    int64_t q = n / d;
+
+    if (((n % d) != 0) && (n < 0))
+    {
+        q--;
+    }
+    return q;
+}
+
+/*
+ * poly_edge_init:
+ *	a -> b 的边, 只保留裁剪区域内的行. 水平边和不在区域内的边返回 ERROR.
+ */
+static int32_t poly_edge_init(poly_edge_t *e, const lcd_point_t *a, const lcd_point_t *b)
+{
+    const lcd_point_t *top = a, *bottom = b;
+    int32_t dx = 0, dy = 0;
+    int64_t m = 0, q = 0;
+
+    if (a->y == b->y)
+    {
+        return ERROR;
+    }
+
+    e->dir = 1;
+    if (a->y > b->y)
+    {
+        top = b;
+        bottom = a;
+        e->dir = -1;
+    }
+
+    //像素中心 y * POLY_SUB + POLY_SUB / 2 在 [top, bottom) 内的行
+    e->y0 = poly_ceil_div(top->y - POLY_SUB / 2, POLY_SUB);
+    e->y1 = poly_ceil_div(bottom->y - POLY_SUB / 2, POLY_SUB);
+    e->y0 = (e->y0 < POLY_CLIP_Y0) ? POLY_CLIP_Y0 : e->y0;
+    e->y1 = (e->y1 > (POLY_CLIP_Y1 + 1)) ? (POLY_CLIP_Y1 + 1) : e->y1;
+    if (e->y0 >= e->y1)
+    {
+        return ERROR;
+    }
+
+    dx = bottom->x - top->x;
+    dy = bottom->y - top->y;
+    e->d = POLY_SUB * dy;
+    m = (int64_t)(top->x - POLY_SUB / 2) * dy + (int64_t)(e->y0 * POLY_SUB + POLY_SUB / 2 - top->y) * dx;
+    q = poly_floor_div(m, e->d);
+    e->q = (int32_t)q;
+    e->r = (int32_t)(m - q * e->d);
+    e->sq = (int32_t)poly_floor_div(dx, dy);
+    e->sr = POLY_SUB * dx - e->sq * e->d;
+
+    return OK;
+}
+
+/*
+ * poly_span:
+ *	画第 y 行的 [x0, x1) 列.
+ */
+static void poly_span(int32_t x0, int32_t x1, int32_t y, int32_t colour)
+{
+    x0 = (x0 < POLY_CLIP_X0) ? POLY_CLIP_X0 : x0;
+    x1 = (x1 > (POLY_CLIP_X1 + 1)) ? (POLY_CLIP_X1 + 1) : x1;
+    if (x0 < x1)
+    {
+        lcd_drv_hspan(x0, x1 - 1, y, colour);
+    }
+}
+
+int32_t poly_fill_sub(const lcd_point_t *pts, int32_t n, int32_t rule, int32_t colour)
+{
+    poly_edge_t edge[POLY_POINT_MAX];
+    poly_edge_t e;
+    int32_t aet[POLY_POINT_MAX];  //活动边, 按交点排序
+    int32_t key[POLY_POINT_MAX];
+    int32_t count = 0, next = 0, active = 0;
+    int32_t i = 0, k = 0, y = 0, t = 0, wind = 0, left = 0;
+
+    if ((pts == NULL) || (n < 3) || (n > POLY_POINT_MAX))
+    {
+        DEBUG_LOG("polygon invalid");
+        return ERROR;
+    }
+
+    //边表, 按起始行排序
+    for (i = 0; i < n; i++)
+    {
+        if (poly_edge_init(&e, &pts[i], &pts[(i + 1) % n]) != OK)
+        {
+            continue;
+        }
+
+        for (k = count; (k > 0) && (edge[k - 1].y0 > e.y0); k--)
+        {
+            edge[k] = edge[k - 1];
+        }
+        edge[k] = e;
+        count++;
+    }
+
+    while ((next < count) || (active > 0))
+    {
+        if (active == 0)
+        {
+            y = edge[next].y0;
+        }
+
+        while ((next < count) && (edge[next].y0 == y))
+        {
+            aet[active++] = next++;
+        }
+
+        //上一行的顺序基本不变, 插入排序几乎不移动
+        for (i = 0; i < active; i++)
+        {
+            t = aet[i];
+            left = edge[t].q + (edge[t].r > 0);
+            for (k = i; (k > 0) && (key[k - 1] > left); k--)
+            {
+                aet[k] = aet[k - 1];
+                key[k] = key[k - 1];
+            }
+            aet[k] = t;
+            key[k] = left;
+        }
+
+        if (rule == POLY_NONZERO)
+        {
+            for (i = 0, wind = 0; i < active; i++)
+            {
+                if (wind == 0)
+                {
+                    left = key[i];
+                }
+                wind += edge[aet[i]].dir;
+                if (wind == 0)
+                {
+                    poly_span(left, key[i], y, colour);
+                }
+            }
+        }
+        else
+        {
+            for (i = 0; (i + 1) < active; i += 2)
+            {
+                poly_span(key[i], key[i + 1], y, colour);
+            }
+        }
+
+        //去掉到头的边, 其余的边移到下一行
+        for (i = 0, k = 0; i < active; i++)
+        {
+            t = aet[i];
+            if ((y + 1) >= edge[t].y1)
+            {
+                continue;
+            }
+
+            edge[t].q += edge[t].sq;
+            edge[t].r += edge[t].sr;
+            if (edge[t].r >= edge[t].d)
+            {
+                edge[t].q++;
+                edge[t].r -= edge[t].d;
+            }
+            aet[k++] = t;
+        }
+        active = k;
+        y++;
+    }
+
+    return OK;
+}
+
+int32_t poly_fill(const lcd_point_t *pts, int32_t n, int32_t rule, int32_t colour)
+{
+    lcd_point_t sub[POLY_POINT_MAX];
+    int32_t i = 0;
+
+    if ((pts == NULL) || (n < 3) || (n > POLY_POINT_MAX))
+    {
+        DEBUG_LOG("polygon invalid");
+        return ERROR;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        sub[i].x = pts[i].x * POLY_SUB;
+        sub[i].y = pts[i].y * POLY_SUB;
+    }
+
+    return poly_fill_sub(sub, n, rule, colour);
+}
+
+int32_t poly_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t colour)
+{
+    lcd_point_t pts[3] = {{x0, y0}, {x1, y1}, {x2, y2}};
+
+    return poly_fill(pts, 3, POLY_EVEN_ODD, colour);
+}
+
+/*
+ * poly_sin:
+ *	angle 单位 0.1 度, 返回值放大 16384 倍, 整度之间线性插值.
+ */
+static int32_t poly_sin(int32_t angle)
+{
+    int32_t a = ((angle % 3600) + 3600) % 3600;
+    int32_t sign = 1, i = 0, f = 0;
+
+    if (a >= 1800)
+    {
+        a -= 1800;
+        sign = -1;
+    }
+    if (a > 900)
+    {
+        a = 1800 - a;
+    }
+
+    i = a / 10;
+    f = a % 10;
+    if (f == 0)
+    {
+        return sign * POLY_SIN[i];
+    }
+    return sign * (POLY_SIN[i] + (POLY_SIN[i + 1] - POLY_SIN[i]) * f / 10);
+}
+
+int32_t poly_rotate(const lcd_point_t *src, int32_t n, int32_t cx, int32_t cy, int32_t angle, lcd_point_t *dst)
+{
+    int32_t s = poly_sin(angle);
+    int32_t c = poly_sin(angle + 900);
+    int64_t x = 0, y = 0;
+    int32_t i = 0;
+
+    if ((src == NULL) || (dst == NULL) || (n < 0))
+    {
+        return ERROR;
+    }
+
+    //x * POLY_SUB * 16384 / 16384, 四舍五入
+    for (i = 0; i < n; i++)
+    {
+        x = (int64_t)src[i].x * c - (int64_t)src[i].y * s;
+        y = (int64_t)src[i].x * s + (int64_t)src[i].y * c;
+        dst[i].x = cx * POLY_SUB + (int32_t)poly_floor_div(x * POLY_SUB + 8192, 16384);
+        dst[i].y = cy * POLY_SUB + (int32_t)poly_floor_div(y * POLY_SUB + 8192, 16384);
+    }
+
+    return OK;
+}
+
+int32_t poly_set_clip(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    x1 = (x1 > (LCD_MAX_X - 1)) ? (LCD_MAX_X - 1) : x1;
+    y1 = (y1 > (LCD_MAX_Y - 1)) ? (LCD_MAX_Y - 1) : y1;
+    if ((x0 > x1) || (y0 > y1))
+    {
+        return ERROR;
+    }
+
+    POLY_CLIP_X0 = x0;
+    POLY_CLIP_Y0 = y0;
+    POLY_CLIP_X1 = x1;
+    POLY_CLIP_Y1 = y1;
+    return OK;
+}
@@ -0,0 +1,89 @@
+#ifndef _LCD_POLY_H_
+#define _LCD_POLY_H_
+
+#include "type.h"
+
+#define POLY_POINT_MAX (64)
+#define POLY_SUB_BITS (4)
+#define POLY_SUB (1 << POLY_SUB_BITS) //poly_fill_sub 的坐标单位为 1/POLY_SUB 像素
+
+typedef enum lcd_poly_rule_e
+{
+    POLY_EVEN_ODD = 0, //被奇数条边包围的区域
+    POLY_NONZERO,      //环绕数不为0的区域, 自相交的部分也填充
+} lcd_poly_rule_t;
+
+typedef struct lcd_point_s
+{
+    int32_t x;
+    int32_t y;
+} lcd_point_t;
+
+/*
+ * 顶点坐标是像素的左上角, 像素 (x, y) 的中心 (x + 0.5, y + 0.5) 在多边形内时被
+ * 填充, 所以顶点为 (0, 0), (8, 0), (8, 4), (0, 4) 的矩形正好填满 8x4 个像素,
+ * 相邻的多边形不会重叠也不会留缝.
+ * 填充按扫描线进行: 边表按起始行排序, 每行只处理与这一行相交的活动边,
+ * 每段用 lcd_drv_hspan 按字节写入显存(不更新硬件).
+ */
+
+/*****************************************************************************
+函 数 名  : poly_fill
+功能描述  : 填充多边形, 首尾顶点自动相连, 超出裁剪区域的部分不画
+输入参数  : pts     顶点, 像素坐标
+            n       顶点数, 3 - POLY_POINT_MAX
+            rule    填充规则, lcd_poly_rule_t
+            colour  颜色
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t poly_fill(const lcd_point_t *pts, int32_t n, int32_t rule, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : poly_fill_sub
+功能描述  : 与 poly_fill 相同, 顶点坐标的单位为 1/POLY_SUB 像素, 用于旋转的
+            指针等需要平滑移动的图形
+输入参数  : pts     顶点, 1/POLY_SUB 像素坐标
+            n       顶点数, 3 - POLY_POINT_MAX
+            rule    填充规则, lcd_poly_rule_t
+            colour  颜色
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t poly_fill_sub(const lcd_point_t *pts, int32_t n, int32_t rule, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : poly_triangle
+功能描述  : 填充三角形, 坐标规则与 poly_fill 相同
+输入参数  : x0, y0, x1, y1, x2, y2  顶点, 像素坐标
+            colour                  颜色
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t poly_triangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t colour);
+
+/*****************************************************************************
+函 数 名  : poly_rotate
+功能描述  : 把以转轴为原点定义的图形旋转后移到 (cx, cy), 结果直接交给
+            poly_fill_sub. 用查表的定点三角函数, 不需要浮点
+输入参数  : src     顶点, 相对转轴的像素坐标
+            n       顶点数
+            cx, cy  转轴在屏幕上的像素坐标
+            angle   角度, 单位 0.1 度, 屏幕上顺时针为正
+输出参数  : dst     旋转后的顶点, 1/POLY_SUB 像素坐标, 可以与 src 相同
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t poly_rotate(const lcd_point_t *src, int32_t n, int32_t cx, int32_t cy, int32_t angle, lcd_point_t *dst);
+
+/*****************************************************************************
+函 数 名  : poly_set_clip
+功能描述  : 设置填充的裁剪区域, 与屏幕取交集. 默认为整屏, 恢复整屏用
+            poly_set_clip(0, 0, LCD_MAX_X - 1, LCD_MAX_Y - 1)
+输入参数  : x0, y0  左上角(包含)
+            x1, y1  右下角(包含)
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t poly_set_clip(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
+#endif
@@ -0,0 +1,146 @@
+#include "rate.h"
+#include "lcd.h"
+#include <time.h>
+#include <errno.h>
+
+#define RATE_CHOOSE_MIN_PCT (80) //整数分之一的帧率不低于最高帧率的80%
+
+static lcd_rate_stat_t RATE_STAT = {0};
+
+static int64_t rate_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static void rate_sleep_until(int64_t t_ns)
+{
+    struct timespec ts;
+
+    ts.tv_sec = t_ns / 1000000000;
+    ts.tv_nsec = t_ns % 1000000000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+}
+
+int32_t rate_calibrate(int32_t x0, int32_t y0, int32_t width, int32_t height)
+{
+    int64_t t0 = 0, cost = 0;
+    int32_t i = 0;
+
+    if ((width <= 0) || (height <= 0))
+    {
+        return ERROR;
+    }
+
+    //重发显存中现有内容, 屏幕不变
+    lcd_lock();
+    t0 = rate_now_ns();
+    for (i = 0; i < RATE_CALIBRATE_FLUSHES; i++)
+    {
+        lcd_drv_mark_dirty(x0, y0, width, height);
+        lcd_flush();
+    }
+    cost = (rate_now_ns() - t0) / RATE_CALIBRATE_FLUSHES;
+    lcd_unlock();
+
+    cost = (cost > 0) ? cost : 1;
+    DEBUG_LOG("Flush %dx%d takes [%lld]us.", width, height, (long long)(cost / 1000));
+
+    return (int32_t)((1000000000LL * RATE_MARGIN_PCT / 100) / cost);
+}
+
+int32_t rate_choose(int32_t src_fps, int32_t max_fps)
+{
+    int32_t n = 0;
+
+    if ((src_fps <= 0) || (max_fps >= src_fps))
+    {
+        return src_fps;
+    }
+
+    max_fps = (max_fps > 0) ? max_fps : 1;
+    for (n = 2; (src_fps / n) > max_fps; n++);
+    if (((src_fps % n) == 0) && ((src_fps / n) * 100 >= max_fps * RATE_CHOOSE_MIN_PCT))
+    {
+        return src_fps / n;
+    }
+
+    return max_fps;
+}
+
+int32_t rate_play(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour, int32_t disp_fps)
+{
+    int64_t t0 = 0, now = 0, slot = 0, due = 0;
+    int64_t frames = 0, frame = 0;
+    int32_t src_fps = 0;
+
+    if (player == NULL)
+    {
+        return ERROR;
+    }
+
+    src_fps = player->hdr.video_fps;
+    if (disp_fps <= 0)
+    {
+        disp_fps = rate_choose(src_fps, rate_calibrate(x0, y0, player->hdr.lcd_width, player->hdr.lcd_height));
+    }
+    disp_fps = (disp_fps > src_fps) ? src_fps : disp_fps;
+
+    memset(&RATE_STAT, 0, sizeof(RATE_STAT));
+    RATE_STAT.src_fps = src_fps;
+    RATE_STAT.disp_fps = disp_fps;
+    DEBUG_LOG("Rate [%d]fps -> [%d]fps.", src_fps, disp_fps);
+
+    frames = player->frame_last - player->frame_first + 1;
+    t0 = rate_now_ns();
+    for (slot = 0;; slot++)
+    {
+        //Bresenham: 时隙 slot 对应 slot * src / disp 帧, 丢帧均匀分布
+        frame = (slot * src_fps) / disp_fps;
+        if (frame >= frames)
+        {
+            break;
+        }
+
+        due = t0 + (slot * 1000000000LL) / disp_fps;
+        rate_sleep_until(due);
+
+        if ((bmp_player_seek(player, player->frame_first + (int32_t)frame) != OK) || (bmp_player_next(player) != OK))
+        {
+            break;
+        }
+        if (bmp_player_present(player, x0, y0, colour) != OK)
+        {
+            break;
+        }
+        RATE_STAT.slots++;
+
+        //刷新超过一个时隙时, 跳到当前时刻所在的时隙, 保持总时长不变
+        now = rate_now_ns();
+        if (now >= (due + 2 * (1000000000LL / disp_fps)))
+        {
+            RATE_STAT.skipped += (uint32_t)((((now - t0) * disp_fps) / 1000000000LL) - slot - 1);
+            slot = (((now - t0) * disp_fps) / 1000000000LL) - 1;
+        }
+    }
+    //最后一帧也显示满它的时长
+    rate_sleep_until(t0 + (frames * 1000000000LL) / src_fps);
+    player->ctrl = LCD_CTRL_STOP;
+
+    DEBUG_LOG("Rate slots [%u] skipped [%u] in [%lld]ms.", RATE_STAT.slots, RATE_STAT.skipped,
+              (long long)((rate_now_ns() - t0) / 1000000));
+
+    return OK;
+}
+
+int32_t rate_get_stat(lcd_rate_stat_t *stat)
+{
+    if (stat == NULL)
+    {
+        return ERROR;
+    }
+
+    *stat = RATE_STAT;
+    return OK;
+}
@@ -0,0 +1,53 @@
+#ifndef _LCD_RATE_H_
+#define _LCD_RATE_H_
+
+#include "type.h"
+#include "bmp.h"
+
+#define RATE_CALIBRATE_FLUSHES (8)
+#define RATE_MARGIN_PCT (90) //只使用实测吞吐量的90%, 给读文件和调度留余量
+
+typedef struct lcd_rate_stat_s
+{
+    uint32_t slots;   //显示的帧数
+    uint32_t skipped; //刷新过慢而跳过的显示时隙
+    int32_t src_fps;
+    int32_t disp_fps;
+} lcd_rate_stat_t;
+
+/*****************************************************************************
+函 数 名  : rate_calibrate
+功能描述  : 实测刷新一个区域的平均耗时, 返回能持续达到的显示帧率
+输入参数  : x0, y0, width, height  刷新区域
+输出参数  : 无
+返 回 值  : 帧率(fps), 失败返回 ERROR
+*****************************************************************************/
+extern int32_t rate_calibrate(int32_t x0, int32_t y0, int32_t width, int32_t height);
+
+/*****************************************************************************
+函 数 名  : rate_choose
+功能描述  : 根据视频帧率和屏幕能达到的帧率选择显示帧率. 能跟上时原速显示;
+            否则优先选视频帧率的整数分之一(均匀地每n帧显示1帧), 比最高
+            帧率损失太多时选最高帧率, 由 rate_play 均匀分布丢帧
+输入参数  : src_fps  视频帧率
+            max_fps  屏幕能达到的帧率
+输出参数  : 无
+返 回 值  : 显示帧率
+*****************************************************************************/
+extern int32_t rate_choose(int32_t src_fps, int32_t max_fps);
+
+/*****************************************************************************
+函 数 名  : rate_play
+功能描述  : 按显示帧率播放, 第k个显示时隙显示第 k * src / disp 帧, 丢帧均匀
+            且总时长与原视频一致. 某次刷新过慢时跳过已经过去的时隙
+输入参数  : player    播放器句柄
+            x0, y0    显示位置
+            colour    颜色(0-反色)
+            disp_fps  显示帧率, 0 为自动(rate_calibrate + rate_choose)
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t rate_play(bmp_player_t *player, int32_t x0, int32_t y0, int32_t colour, int32_t disp_fps);
+extern int32_t rate_get_stat(lcd_rate_stat_t *stat);
+
+#endif
@@ -0,0 +1,339 @@
+#include "stream.h"
+#include "gray.h"
+#include "dither.h"
+#include "lcd.h"
+#include "frc.h"
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <poll.h>
+
+typedef struct lcd_stream_frame_s
+{
+    uint8_t *bmp;   //页格式数据
+    uint64_t t_in;  //从管道读完的时间(us)
+} lcd_stream_frame_t;
+
+static int32_t STREAM_FD = -1;
+static int32_t STREAM_WIDTH = 0;
+static int32_t STREAM_HEIGHT = 0;
+static int32_t STREAM_FRAME_LEN = 0;
+static uint8_t *STREAM_RAW = NULL;
+
+static lcd_stream_frame_t *STREAM_RING = NULL;
+static lcd_stream_frame_t STREAM_CUR = {0};
+static int32_t STREAM_DEPTH = 0;
+static int32_t STREAM_HEAD = 0; //下一个写入位置
+static int32_t STREAM_COUNT = 0;
+static int32_t STREAM_EOF = 0;
+static int32_t STREAM_DROP = 0;
+static dither_mode_t STREAM_DITHER = DITHER_NONE;
+static int32_t STREAM_FRC = 0;
+static volatile int32_t STREAM_RUN = 0;
+
+static pthread_t STREAM_THREAD;
+static pthread_mutex_t STREAM_LOCK = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t STREAM_COND = PTHREAD_COND_INITIALIZER;
+
+static lcd_stream_stat_t STREAM_STAT = {0};
+static uint64_t STREAM_LAT_SUM = 0;
+
+static uint64_t stream_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+#define STREAM_POLL_MS (100)
+
+static int32_t stream_read_full(int32_t fd, uint8_t *buf, int32_t len)
+{
+    int32_t got = 0;
+    ssize_t n = 0;
+    struct pollfd pfd = {0};
+
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    while (got < len)
+    {
+        //定时醒来检查退出标志, 不会永远阻塞在read上
+        n = poll(&pfd, 1, STREAM_POLL_MS);
+        if (!STREAM_RUN)
+        {
+            return ERROR;
+        }
+        if (n <= 0)
+        {
+            if ((n == 0) || (errno == EINTR))
+                continue;
+            return ERROR;
+        }
+
+        n = read(fd, buf + got, len - got);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return ERROR;
+        }
+        if (n == 0)
+        {
+            return ERROR;
+        }
+        got += (int32_t)n;
+    }
+
+    return OK;
+}
+
+static void *stream_reader(void *arg)
+{
+    lcd_stream_frame_t *slot = NULL;
+    uint8_t *tmp = NULL;
+    uint8_t *swap = NULL;
+    uint64_t t_in = 0;
+
+    (void)arg;
+    tmp = malloc(STREAM_FRAME_LEN);
+    while ((tmp != NULL) && STREAM_RUN)
+    {
+        if (stream_read_full(STREAM_FD, STREAM_RAW, STREAM_WIDTH * STREAM_HEIGHT) != OK)
+        {
+            break;
+        }
+        t_in = stream_now_us();
+        if (STREAM_FRC)
+        {
+            //FRC线程自己按节拍刷新, 这里只提交最新的源帧
+            frc_submit(STREAM_RAW, STREAM_WIDTH);
+            pthread_mutex_lock(&STREAM_LOCK);
+            STREAM_STAT.frames++;
+            pthread_cond_broadcast(&STREAM_COND);
+            pthread_mutex_unlock(&STREAM_LOCK);
+            continue;
+        }
+        dither_2bpp(STREAM_DITHER, STREAM_RAW, STREAM_WIDTH, STREAM_WIDTH, STREAM_HEIGHT, tmp, STREAM_WIDTH);
+
+        pthread_mutex_lock(&STREAM_LOCK);
+        while (!STREAM_DROP && STREAM_RUN && (STREAM_COUNT == STREAM_DEPTH))
+        {
+            //缓冲满, 阻塞读取, 由管道反压上游
+            pthread_cond_wait(&STREAM_COND, &STREAM_LOCK);
+        }
+        if (STREAM_COUNT == STREAM_DEPTH)
+        {
+            //缓冲满, 丢弃最旧的一帧, 保证延迟有上限
+            STREAM_COUNT--;
+            STREAM_STAT.drops++;
+        }
+        slot = &STREAM_RING[STREAM_HEAD];
+        //与环中的缓冲区交换, 避免拷贝
+        swap = slot->bmp;
+        slot->bmp = tmp;
+        tmp = swap;
+        slot->t_in = t_in;
+        STREAM_HEAD = (STREAM_HEAD + 1) % STREAM_DEPTH;
+        STREAM_COUNT++;
+        pthread_cond_broadcast(&STREAM_COND);
+        pthread_mutex_unlock(&STREAM_LOCK);
+    }
+
+    pthread_mutex_lock(&STREAM_LOCK);
+    STREAM_EOF = 1;
+    pthread_cond_signal(&STREAM_COND);
+    pthread_mutex_unlock(&STREAM_LOCK);
+
+    free(tmp);
+    return NULL;
+}
+
+int32_t stream_init(int32_t fd, int32_t width, int32_t height, int32_t depth, int32_t drop)
+{
+    int32_t i = 0;
+
+    if ((fd < 0) || (width <= 0) || (height <= 0) || (STREAM_RING != NULL))
+    {
+        return ERROR;
+    }
+
+    STREAM_FD = fd;
+    STREAM_WIDTH = width;
+    STREAM_HEIGHT = height;
+    STREAM_FRAME_LEN = GRAY_FRAME_LEN(width, height);
+    STREAM_DEPTH = (depth > 0) ? depth : STREAM_DEPTH_DEFAULT;
+    STREAM_HEAD = 0;
+    STREAM_COUNT = 0;
+    STREAM_EOF = 0;
+    STREAM_DROP = drop;
+    memset(&STREAM_STAT, 0, sizeof(STREAM_STAT));
+    STREAM_LAT_SUM = 0;
+
+    STREAM_RAW = malloc((size_t)width * height);
+    STREAM_RING = calloc(STREAM_DEPTH, sizeof(lcd_stream_frame_t));
+    STREAM_CUR.bmp = malloc(STREAM_FRAME_LEN);
+    if ((STREAM_RAW == NULL) || (STREAM_RING == NULL) || (STREAM_CUR.bmp == NULL))
+    {
+        stream_dinit();
+        return ERROR;
+    }
+
+    for (i = 0; i < STREAM_DEPTH; i++)
+    {
+        STREAM_RING[i].bmp = malloc(STREAM_FRAME_LEN);
+        if (STREAM_RING[i].bmp == NULL)
+        {
+            stream_dinit();
+            return ERROR;
+        }
+    }
+
+    STREAM_RUN = 1;
+    if (pthread_create(&STREAM_THREAD, NULL, stream_reader, NULL) != 0)
+    {
+        STREAM_RUN = 0;
+        stream_dinit();
+        return ERROR;
+    }
+
+    DEBUG_LOG("Stream %dx%d, [%d] bytes per frame, depth [%d].", width, height, STREAM_FRAME_LEN, STREAM_DEPTH);
+
+    return OK;
+}
+
+int32_t stream_set_dither(dither_mode_t mode)
+{
+    if ((mode < DITHER_NONE) || (mode >= DITHER_MAX) || (STREAM_RING != NULL))
+    {
+        return ERROR;
+    }
+
+    STREAM_DITHER = mode;
+    return OK;
+}
+
+int32_t stream_set_frc(int32_t enable)
+{
+    if (STREAM_RING != NULL)
+    {
+        return ERROR;
+    }
+
+    STREAM_FRC = enable;
+    return OK;
+}
+
+int32_t stream_dinit(void)
+{
+    int32_t i = 0;
+
+    if (STREAM_RUN)
+    {
+        pthread_mutex_lock(&STREAM_LOCK);
+        STREAM_RUN = 0;
+        pthread_cond_broadcast(&STREAM_COND);
+        pthread_mutex_unlock(&STREAM_LOCK);
+        pthread_join(STREAM_THREAD, NULL);
+    }
+    STREAM_FD = -1;
+
+    if (STREAM_STAT.frames > 0)
+    {
+        DEBUG_LOG("Stream frames [%u] drops [%u] latency min/avg/max [%u/%u/%u]us.", STREAM_STAT.frames,
+                  STREAM_STAT.drops, STREAM_STAT.lat_min_us, STREAM_STAT.lat_avg_us, STREAM_STAT.lat_max_us);
+    }
+
+    if (STREAM_RING != NULL)
+    {
+        for (i = 0; i < STREAM_DEPTH; i++)
+        {
+            free(STREAM_RING[i].bmp);
+        }
+        free(STREAM_RING);
+        STREAM_RING = NULL;
+    }
+
+    free(STREAM_RAW);
+    STREAM_RAW = NULL;
+    free(STREAM_CUR.bmp);
+    STREAM_CUR.bmp = NULL;
+
+    return OK;
+}
+
+int32_t stream_show(int32_t x0, int32_t y0, int32_t colour)
+{
+    lcd_stream_frame_t *slot = NULL;
+    uint8_t *tmp = NULL;
+    uint32_t lat = 0;
+    uint32_t frames = 0;
+
+    if (STREAM_RING == NULL)
+    {
+        return LCD_CTRL_STOP;
+    }
+
+    if (STREAM_FRC)
+    {
+        //显示由FRC线程完成, 这里只等待下一帧或输入结束
+        pthread_mutex_lock(&STREAM_LOCK);
+        frames = STREAM_STAT.frames;
+        while ((STREAM_STAT.frames == frames) && !STREAM_EOF)
+        {
+            pthread_cond_wait(&STREAM_COND, &STREAM_LOCK);
+        }
+        frames = STREAM_STAT.frames - frames;
+        pthread_mutex_unlock(&STREAM_LOCK);
+        return (frames > 0) ? LCD_CTRL_RUN : LCD_CTRL_STOP;
+    }
+
+    pthread_mutex_lock(&STREAM_LOCK);
+    while ((STREAM_COUNT == 0) && !STREAM_EOF)
+    {
+        pthread_cond_wait(&STREAM_COND, &STREAM_LOCK);
+    }
+
+    if (STREAM_COUNT == 0)
+    {
+        pthread_mutex_unlock(&STREAM_LOCK);
+        return LCD_CTRL_STOP;
+    }
+
+    slot = &STREAM_RING[(STREAM_HEAD - STREAM_COUNT + STREAM_DEPTH) % STREAM_DEPTH];
+    tmp = STREAM_CUR.bmp;
+    STREAM_CUR = *slot;
+    slot->bmp = tmp;
+    STREAM_COUNT--;
+    pthread_cond_broadcast(&STREAM_COND);
+    pthread_mutex_unlock(&STREAM_LOCK);
+
+    if (bmp_present(x0, y0, STREAM_WIDTH, STREAM_HEIGHT, STREAM_CUR.bmp, colour) != OK)
+    {
+        return LCD_CTRL_STOP;
+    }
+
+    lat = (uint32_t)(stream_now_us() - STREAM_CUR.t_in);
+    pthread_mutex_lock(&STREAM_LOCK);
+    STREAM_STAT.frames++;
+    STREAM_LAT_SUM += lat;
+    STREAM_STAT.lat_min_us = ((STREAM_STAT.frames == 1) || (lat < STREAM_STAT.lat_min_us)) ? lat : STREAM_STAT.lat_min_us;
+    STREAM_STAT.lat_max_us = (lat > STREAM_STAT.lat_max_us) ? lat : STREAM_STAT.lat_max_us;
+    STREAM_STAT.lat_avg_us = (uint32_t)(STREAM_LAT_SUM / STREAM_STAT.frames);
+    pthread_mutex_unlock(&STREAM_LOCK);
+
+    return LCD_CTRL_RUN;
+}
+
+int32_t stream_get_stat(lcd_stream_stat_t *stat)
+{
+    if (stat == NULL)
+    {
+        return ERROR;
+    }
+
+    pthread_mutex_lock(&STREAM_LOCK);
+    *stat = STREAM_STAT;
+    pthread_mutex_unlock(&STREAM_LOCK);
+
+    return OK;
+}
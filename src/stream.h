@@ -0,0 +1,64 @@
+#ifndef _LCD_STREAM_H_
+#define _LCD_STREAM_H_
+
+#include "type.h"
+#include "bmp.h"
+#include "dither.h"
+
+#define STREAM_DEPTH_DEFAULT (3)
+
+typedef struct lcd_stream_stat_s
+{
+    uint32_t frames;     //已显示的帧数
+    uint32_t drops;      //缓冲满时丢弃的帧数
+    uint32_t lat_min_us; //从管道读完一帧到屏幕刷新完成的延迟
+    uint32_t lat_max_us;
+    uint32_t lat_avg_us;
+} lcd_stream_stat_t;
+
+/*****************************************************************************
+函 数 名  : stream_init
+功能描述  : 从文件描述符(管道/stdin)读取8bit灰度原始帧, 后台线程实时转换为
+            4级灰度页格式, 最多缓存depth帧
+输入参数  : fd      输入, 例如 ffmpeg -f rawvideo -pix_fmt gray 的输出
+            width   帧宽度
+            height  帧高度
+            depth   缓冲帧数
+            drop    缓冲满时: 0-阻塞读取(反压上游), 1-丢弃最旧的帧(实时源)
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t stream_init(int32_t fd, int32_t width, int32_t height, int32_t depth, int32_t drop);
+extern int32_t stream_dinit(void);
+
+/*****************************************************************************
+函 数 名  : stream_set_dither
+功能描述  : 设置实时流的8bit到4级灰度的转换方式, 须在 stream_init 之前调用
+输入参数  : mode  抖动方式, 默认 DITHER_NONE
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t stream_set_dither(dither_mode_t mode);
+
+/*****************************************************************************
+函 数 名  : stream_set_frc
+功能描述  : 输入帧交给已启动的FRC线程(frc_init)显示, 不再经过抖动和缓冲环,
+            stream_show 只等待下一帧. 须在 stream_init 之前调用
+输入参数  : enable  1-使用FRC, 0-普通4级灰度
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t stream_set_frc(int32_t enable);
+
+/*****************************************************************************
+函 数 名  : stream_show
+功能描述  : 等待下一帧并通过 bmp_present 显示, 与 bmp_show 用法相同
+输入参数  : x0, y0  显示位置
+            colour  颜色(0-反色)
+输出参数  : 无
+返 回 值  : LCD_CTRL_RUN, 输入结束时返回 LCD_CTRL_STOP
+*****************************************************************************/
+extern int32_t stream_show(int32_t x0, int32_t y0, int32_t colour);
+extern int32_t stream_get_stat(lcd_stream_stat_t *stat);
+
+#endif
@@ -0,0 +1,278 @@
+#include "strip.h"
+#include "lcd.h"
+#include <pthread.h>
+
+typedef struct lcd_strip_s
+{
+    int8_t *text;     //NULL 为空闲
+    uint32_t hash;
+    int32_t font;
+    int32_t bcolor;
+    int32_t fcolor;
+    int32_t phase;    //第一行在页内的行号, 与显示位置 y 相同
+    int32_t width;    //条带宽度, 即每页的字节数
+    int32_t pages;
+    int32_t bytes;
+    uint32_t stamp;   //最近一次使用, 用于 LRU 淘汰
+    uint8_t *data;
+} lcd_strip_t;
+
+static lcd_strip_t STRIP_CACHE[STRIP_CACHE_MAX];
+static int32_t STRIP_BUDGET = STRIP_CACHE_BYTES_DEFAULT;
+static uint32_t STRIP_STAMP = 0;
+static lcd_strip_stat_t STRIP_STAT = {0};
+static pthread_mutex_t STRIP_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
+static uint32_t strip_hash(const int8_t *str)
+{
+    uint32_t h = 2166136261u;
+
+    while (*str != '\0')
+    {
+        h = (h ^ (uint8_t)*str++) * 16777619u;
+    }
+
+    return h;
+}
+
+static void strip_free(lcd_strip_t *s)
+{
+    if (s->text == NULL)
+    {
+        return;
+    }
+
+    STRIP_STAT.entries--;
+    STRIP_STAT.bytes -= s->bytes;
+    free(s->text);
+    free(s->data);
+    memset(s, 0, sizeof(lcd_strip_t));
+}
+
+int32_t strip_render(uint8_t *data, int32_t stride, int32_t phase, const int8_t *str, int32_t bcolor, int32_t fcolor)
+{
+    int32_t i = 0, j = 0, b = 0, r = 0, idx = 0;
+    const uint8_t *dat = NULL;
+    uint8_t *dst = NULL;
+    uint8_t level = 0;
+    font_t *pfont = lcd_get_font();
+
+    if ((data == NULL) || (str == NULL) || (phase < 0) || (phase >= LCD_DRV_PAGE_ROW))
+    {
+        return ERROR;
+    }
+
+    for (i = 0; str[i] != '\0'; i++)
+    {
+        idx = _check_invalid_char_(str[i]);
+        for (j = 0; j < pfont->height; j++)
+        {
+            dat = font_glyph_row(pfont, idx, j);
+            r = phase + j;
+            dst = data + (r / LCD_DRV_PAGE_ROW) * stride + i * pfont->width;
+            for (b = 0; b < pfont->width; b++)
+            {
+                level = (uint8_t)(((dat[b / 8] & (0x80 >> (b % 8))) ? fcolor : bcolor) & LCD_DRV_COLOUR_BIT_MSK);
+                dst[b] |= (uint8_t)(level << ((LCD_DRV_PAGE_ROW - (r % LCD_DRV_PAGE_ROW) - 1) * LCD_DRV_COLOUR_BIT));
+            }
+        }
+    }
+
+    return OK;
+}
+
+static lcd_strip_t *strip_lookup(const int8_t *str, font_t *pfont, int32_t phase, int32_t bcolor, int32_t fcolor)
+{
+    lcd_strip_t *s = NULL;
+    uint32_t hash = strip_hash(str);
+    int32_t i = 0;
+
+    for (i = 0; i < STRIP_CACHE_MAX; i++)
+    {
+        s = &STRIP_CACHE[i];
+        if ((s->text != NULL) && (s->hash == hash) && (s->font == pfont->name) && (s->phase == phase) &&
+            (s->bcolor == bcolor) && (s->fcolor == fcolor) && (strcmp((char *)s->text, (char *)str) == 0))
+        {
+            return s;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * strip_make_room:
+ *	淘汰最久没用的条带, 直到能放下 bytes 字节并且有空闲项.
+ */
+static lcd_strip_t *strip_make_room(int32_t bytes)
+{
+    lcd_strip_t *free_slot = NULL, *oldest = NULL;
+    int32_t i = 0;
+
+    while (1)
+    {
+        free_slot = NULL;
+        oldest = NULL;
+        for (i = 0; i < STRIP_CACHE_MAX; i++)
+        {
+            if (STRIP_CACHE[i].text == NULL)
+            {
+                free_slot = (free_slot == NULL) ? &STRIP_CACHE[i] : free_slot;
+            }
+            else if ((oldest == NULL) || ((int32_t)(STRIP_CACHE[i].stamp - oldest->stamp) < 0))
+            {
+                oldest = &STRIP_CACHE[i];
+            }
+        }
+
+        if ((free_slot != NULL) && ((STRIP_STAT.bytes + bytes) <= STRIP_BUDGET))
+        {
+            return free_slot;
+        }
+        if (oldest == NULL)
+        {
+            return NULL;
+        }
+
+        strip_free(oldest);
+        STRIP_STAT.evictions++;
+    }
+}
+
+int32_t strip_puts_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor)
+{
+    font_t *pfont = lcd_get_font();
+    lcd_strip_t tmp, *s = NULL;
+    int32_t phase = 0, width = 0, c0 = 0, c1 = 0;
+
+    if ((str == NULL) || (y_pos <= 0 - (pfont->height)) || (y_pos >= LCD_MAX_Y) || (x_disp1 < x_disp0))
+    {
+        return ERROR;
+    }
+
+    width = (int32_t)strlen((char *)str) * pfont->width;
+    phase = ((y_pos % LCD_DRV_PAGE_ROW) + LCD_DRV_PAGE_ROW) % LCD_DRV_PAGE_ROW;
+
+    //放不进缓存的长字符串每次都要重画, 只画可见的字符
+    if ((((phase + pfont->height + LCD_DRV_PAGE_ROW - 1) / LCD_DRV_PAGE_ROW) * width) > STRIP_BUDGET)
+    {
+        return lcd_puts_clip(x_pos, x_disp0, x_disp1, y_pos, str, bcolor, fcolor);
+    }
+
+    //可视部分: [x_disp0, x_disp1] 与字符串和屏幕的交集
+    c0 = (x_disp0 > x_pos) ? x_disp0 : x_pos;
+    c0 = (c0 < 0) ? 0 : c0;
+    c1 = (x_disp1 < (x_pos + width - 1)) ? x_disp1 : (x_pos + width - 1);
+    c1 = (c1 > (LCD_MAX_X - 1)) ? (LCD_MAX_X - 1) : c1;
+    if (c0 > c1)
+    {
+        return OK;
+    }
+
+    pthread_mutex_lock(&STRIP_LOCK);
+    s = strip_lookup(str, pfont, phase, bcolor, fcolor);
+    if (s != NULL)
+    {
+        STRIP_STAT.hits++;
+    }
+    else
+    {
+        STRIP_STAT.misses++;
+
+        memset(&tmp, 0, sizeof(tmp));
+        tmp.hash = strip_hash(str);
+        tmp.font = pfont->name;
+        tmp.bcolor = bcolor;
+        tmp.fcolor = fcolor;
+        tmp.phase = phase;
+        tmp.width = width;
+        tmp.pages = (phase + pfont->height + LCD_DRV_PAGE_ROW - 1) / LCD_DRV_PAGE_ROW;
+        tmp.bytes = tmp.pages * tmp.width;
+        tmp.data = calloc(tmp.bytes, 1);
+        if (tmp.data == NULL)
+        {
+            pthread_mutex_unlock(&STRIP_LOCK);
+            return ERROR;
+        }
+        strip_render(tmp.data, tmp.width, phase, str, bcolor, fcolor);
+
+        s = strip_make_room(tmp.bytes);
+        tmp.text = (s != NULL) ? (int8_t *)strdup((char *)str) : NULL;
+        if (tmp.text == NULL)
+        {
+            lcd_drv_blit_strip(c0, y_pos, c1 - c0 + 1, pfont->height, tmp.data, tmp.width, c0 - x_pos);
+            free(tmp.data);
+            pthread_mutex_unlock(&STRIP_LOCK);
+            return OK;
+        }
+
+        *s = tmp;
+        STRIP_STAT.entries++;
+        STRIP_STAT.bytes += s->bytes;
+    }
+
+    s->stamp = ++STRIP_STAMP;
+    lcd_drv_blit_strip(c0, y_pos, c1 - c0 + 1, pfont->height, s->data, s->width, c0 - x_pos);
+    pthread_mutex_unlock(&STRIP_LOCK);
+
+    return OK;
+}
+
+int32_t strip_set_budget(int32_t bytes)
+{
+    lcd_strip_t *oldest = NULL;
+    int32_t i = 0;
+
+    if (bytes < 0)
+    {
+        return ERROR;
+    }
+
+    pthread_mutex_lock(&STRIP_LOCK);
+    STRIP_BUDGET = bytes;
+    //按新预算淘汰, 最旧的先走
+    while (STRIP_STAT.bytes > STRIP_BUDGET)
+    {
+        oldest = NULL;
+        for (i = 0; i < STRIP_CACHE_MAX; i++)
+        {
+            if ((STRIP_CACHE[i].text != NULL) && ((oldest == NULL) || ((int32_t)(STRIP_CACHE[i].stamp - oldest->stamp) < 0)))
+            {
+                oldest = &STRIP_CACHE[i];
+            }
+        }
+        strip_free(oldest);
+        STRIP_STAT.evictions++;
+    }
+    pthread_mutex_unlock(&STRIP_LOCK);
+
+    return OK;
+}
+
+int32_t strip_get_stat(lcd_strip_stat_t *stat)
+{
+    if (stat == NULL)
+    {
+        return ERROR;
+    }
+
+    pthread_mutex_lock(&STRIP_LOCK);
+    *stat = STRIP_STAT;
+    pthread_mutex_unlock(&STRIP_LOCK);
+
+    return OK;
+}
+
+int32_t strip_clear(void)
+{
+    int32_t i = 0;
+
+    pthread_mutex_lock(&STRIP_LOCK);
+    for (i = 0; i < STRIP_CACHE_MAX; i++)
+    {
+        strip_free(&STRIP_CACHE[i]);
+    }
+    pthread_mutex_unlock(&STRIP_LOCK);
+
+    return OK;
+}
@@ -0,0 +1,59 @@
+#ifndef _LCD_STRIP_H_
+#define _LCD_STRIP_H_
+
+#include "type.h"
+
+#define STRIP_CACHE_MAX (32)
+#define STRIP_CACHE_BYTES_DEFAULT (16 * 1024)
+
+typedef struct lcd_strip_stat_s
+{
+    uint32_t hits;      //命中缓存的次数
+    uint32_t misses;    //需要重新渲染的次数
+    uint32_t evictions; //因超出预算被淘汰的条带
+    int32_t entries;    //当前缓存的条带数
+    int32_t bytes;      //当前缓存占用的字节数
+} lcd_strip_stat_t;
+
+/*****************************************************************************
+函 数 名  : strip_puts_s
+功能描述  : 与 lcd_puts_s 相同, 但整串先渲染为页格式条带(按文字, 字体, 颜色和
+            y 在页内的偏移缓存), 显示时只按窗口拷贝字节, 滚动同一字符串时
+            不再逐像素画字
+输入参数  : x_pos           字符串的x坐标
+            x_disp0, x_disp1 可视部分的起止列(包含)
+            y_pos           字符串的y坐标
+            str             字符串
+            bcolor, fcolor  背景色和前景色
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t strip_puts_s(int32_t x_pos, int32_t x_disp0, int32_t x_disp1, int32_t y_pos, int8_t *str, int32_t bcolor, int32_t fcolor);
+
+/*****************************************************************************
+函 数 名  : strip_set_budget
+功能描述  : 设置缓存的字节预算, 超出时淘汰最久没有用过的条带,
+            单个条带超过预算的字符串不缓存, 改用 lcd_puts_clip 只画可见字符
+输入参数  : bytes  字节数, 默认 STRIP_CACHE_BYTES_DEFAULT
+输出参数  : 无
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t strip_set_budget(int32_t bytes);
+
+/*****************************************************************************
+函 数 名  : strip_render
+功能描述  : 用当前字体把字符串画到页格式条带中(只或上像素, data 需先清零),
+            第 0 行画在第一页的第 phase 行, 与 lcd_drv_blit_strip 的格式相同
+输入参数  : data            条带, (phase + 字体高度 + 3) / 4 页, 每页 stride 字节
+            stride          每页的字节数, 不小于字符串宽度
+            phase           第一行在页内的行号, 0 - 3
+            str             字符串
+            bcolor, fcolor  背景色和前景色
+输出参数  : data
+返 回 值  : OK/ERROR
+*****************************************************************************/
+extern int32_t strip_render(uint8_t *data, int32_t stride, int32_t phase, const int8_t *str, int32_t bcolor, int32_t fcolor);
+extern int32_t strip_get_stat(lcd_strip_stat_t *stat);
+extern int32_t strip_clear(void);
+
+#endif
@@ -0,0 +1,354 @@
+/*
+ * font_pack.c:
+ *	Font packer: raw bitmaps in font.c -> font_packed.c.
+ *
+ *	For every glyph the blank rows above and below are dropped and each
+ *	remaining row is replaced by its number in a per-font table of unique
+ *	rows, so the renderer still gets a pointer to a plain bitmap row and
+ *	needs no decode buffer. Identical glyph records are stored once. Fonts
+ *	that would not get smaller (the 1-byte-wide small fonts) are copied
+ *	raw. With -s only the listed characters are kept, the others draw blank.
+ *	Build with -DFONT_PACKED=0 so that font.c provides the raw bitmaps.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "../type.h"
+#include "../font.h"
+
+#if FONT_PACKED
+#error "font_pack must be built with -DFONT_PACKED=0"
+#endif
+
+#define PACK_NAME_LEN (1024)
+#define PACK_GLYPH_MAX (256)
+#define PACK_ROW_MAX (4096)
+#define PACK_REC_MAX (64 * 1024)
+
+#define HELP_PRINT_FORMATS "  %-10s -- %s\r\n"
+
+typedef struct pack_font_s
+{
+    int32_t wbyte;
+    int32_t glyphs;
+    int32_t rows;                         //行表中的行数
+    uint8_t row[PACK_ROW_MAX][4];
+    int32_t rec_len;
+    uint8_t rec[PACK_REC_MAX];
+    int32_t offset[PACK_GLYPH_MAX];
+    int32_t wide;
+    int32_t raw;                          //压缩后不比原始点阵小, 原样输出
+} pack_font_t;
+
+static void print_usage(const char *exe_name)
+{
+    printf("Usage: %s -o OUTPUT [options]\r\n", exe_name);
+    printf("Options:\r\n");
+    printf(HELP_PRINT_FORMATS, "-h,--help", "Show this help message.");
+    printf(HELP_PRINT_FORMATS, "-o OUTPUT,--output=OUTPUT", "C file to write, normally font_packed.c.");
+    printf(HELP_PRINT_FORMATS, "-s CHARS,--subset=CHARS", "Keep only these characters, the others draw blank.");
+    printf("\r\n");
+}
+
+static int32_t pack_row_id(pack_font_t *pk, const uint8_t *row)
+{
+    int32_t i = 0;
+
+    for (i = 0; i < pk->rows; i++)
+    {
+        if (memcmp(pk->row[i], row, pk->wbyte) == 0)
+        {
+            return i;
+        }
+    }
+
+    if (pk->rows >= PACK_ROW_MAX)
+    {
+        return ERROR;
+    }
+    memcpy(pk->row[pk->rows], row, pk->wbyte);
+    return pk->rows++;
+}
+
+static int32_t pack_blank(const uint8_t *row, int32_t wbyte)
+{
+    int32_t i = 0;
+
+    for (i = 0; i < wbyte; i++)
+    {
+        if (row[i])
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * pack_font:
+ *	两遍: 第一遍建行表, 决定行号用1字节还是2字节; 第二遍生成字形记录.
+ */
+static int32_t pack_font(const font_t *pfont, const char *subset, pack_font_t *pk)
+{
+    const uint8_t *dat = NULL;
+    uint8_t rec[2 + 2 * 32];
+    int32_t g = 0, r = 0, top = 0, bottom = 0, id = 0, n = 0, pass = 0, i = 0;
+
+    memset(pk, 0, sizeof(pack_font_t));
+    pk->wbyte = (pfont->width + 7) / 8;
+    pk->glyphs = pfont->cmax - pfont->cmin + 1;
+    if ((pk->wbyte > 4) || (pfont->height > 32) || (pk->glyphs > PACK_GLYPH_MAX))
+    {
+        return ERROR;
+    }
+
+    for (pass = 0; pass < 2; pass++)
+    {
+        pk->wide = (pk->rows > 256);
+        pk->rec_len = 0;
+        for (g = 0; g < pk->glyphs; g++)
+        {
+            dat = pfont->pdata + g * pfont->height * pk->wbyte;
+            top = 0;
+            bottom = 0;
+            if ((subset == NULL) || (strchr(subset, pfont->cmin + g) != NULL))
+            {
+                for (top = 0; (top < pfont->height) && pack_blank(dat + top * pk->wbyte, pk->wbyte); top++);
+                for (bottom = pfont->height; (bottom > top) && pack_blank(dat + (bottom - 1) * pk->wbyte, pk->wbyte); bottom--);
+            }
+
+            top = (bottom > top) ? top : 0;
+            n = 0;
+            rec[n++] = (uint8_t)top;
+            rec[n++] = (uint8_t)(bottom - top);
+            for (r = top; r < bottom; r++)
+            {
+                id = pack_row_id(pk, dat + r * pk->wbyte);
+                if (id == ERROR)
+                {
+                    return ERROR;
+                }
+                rec[n++] = (uint8_t)(id & 0xFF);
+                if (pk->wide)
+                {
+                    rec[n++] = (uint8_t)(id >> 8);
+                }
+            }
+
+            if (pass == 0)
+            {
+                continue;
+            }
+
+            //相同的记录只存一次(空白字符等)
+            for (i = 0; i < g; i++)
+            {
+                if ((pk->offset[i] + n <= pk->rec_len) && (memcmp(pk->rec + pk->offset[i], rec, n) == 0))
+                {
+                    break;
+                }
+            }
+            if (i < g)
+            {
+                pk->offset[g] = pk->offset[i];
+                continue;
+            }
+
+            if ((pk->rec_len + n) > 0xFFFF)
+            {
+                return ERROR;
+            }
+            pk->offset[g] = pk->rec_len;
+            memcpy(pk->rec + pk->rec_len, rec, n);
+            pk->rec_len += n;
+        }
+    }
+
+    pk->raw = ((pk->rows * pk->wbyte + pk->rec_len + pk->glyphs * (int32_t)sizeof(uint16)) >=
+               (pk->glyphs * pfont->height * pk->wbyte));
+    if (pk->raw)
+    {
+        //原始点阵放在 rec 中, 不满足子集的字符清零
+        pk->rec_len = pk->glyphs * pfont->height * pk->wbyte;
+        for (g = 0; g < pk->glyphs; g++)
+        {
+            n = pfont->height * pk->wbyte;
+            dat = pfont->pdata + g * n;
+            if ((subset == NULL) || (strchr(subset, pfont->cmin + g) != NULL))
+            {
+                memcpy(pk->rec + g * n, dat, n);
+            }
+            else
+            {
+                memset(pk->rec + g * n, 0, n);
+            }
+        }
+    }
+
+    return OK;
+}
+
+static void pack_write_bytes(FILE *out, const uint8_t *dat, int32_t len, int32_t per_line)
+{
+    int32_t i = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        fprintf(out, "%s0x%02X,%s", ((i % per_line) == 0) ? "    " : "", dat[i],
+                (((i % per_line) == (per_line - 1)) || (i == (len - 1))) ? "\n" : " ");
+    }
+}
+
+static void pack_write_font(FILE *out, const font_t *pfont, const pack_font_t *pk)
+{
+    int32_t g = 0, i = 0, len = 0, pos = 0;
+    char name[32] = {0};
+
+    snprintf(name, sizeof(name), "FONT_EN_%dX%d", pfont->width, pfont->height);
+
+    if (pk->raw)
+    {
+        fprintf(out, "const uint8 %s[] =\n{\n", name);
+        for (g = 0; g < pk->glyphs; g++)
+        {
+            len = pfont->height * pk->wbyte;
+            fprintf(out, "    /*\"%c\",%d*/\n", pfont->cmin + g, g);
+            pack_write_bytes(out, pk->rec + g * len, len, 16);
+        }
+        fprintf(out, "};\n\n");
+        return;
+    }
+
+    fprintf(out, "const uint8 %s_ROWS[] =\n{\n", name);
+    for (i = 0; i < pk->rows; i++)
+    {
+        pack_write_bytes(out, pk->row[i], pk->wbyte, pk->wbyte);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const uint8 %s_GLYPH[] =\n{\n", name);
+    for (g = 0; g < pk->glyphs; g++)
+    {
+        //记录按第一个使用者的顺序存放, 共用记录的字符不再输出
+        if (pk->offset[g] != pos)
+        {
+            continue;
+        }
+        len = 2 + pk->rec[pos + 1] * (pk->wide ? 2 : 1);
+        fprintf(out, "    /*\"%c\",%d*/\n", pfont->cmin + g, g);
+        pack_write_bytes(out, pk->rec + pos, len, 16);
+        pos += len;
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const uint16 %s_OFFSET[] =\n{\n", name);
+    for (g = 0; g < pk->glyphs; g++)
+    {
+        fprintf(out, "%s%d,%s", ((g % 16) == 0) ? "    " : "", pk->offset[g],
+                (((g % 16) == 15) || (g == (pk->glyphs - 1))) ? "\n" : " ");
+    }
+    fprintf(out, "};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+    int opt = 0;
+    int option_index = 0;
+    char out_path[PACK_NAME_LEN + 1] = {0};
+    char *subset = NULL;
+    static pack_font_t pk[FONT_MAX];
+    font_t *pfont = NULL;
+    int32_t f = 0, raw = 0, packed = 0, raw_all = 0, packed_all = 0;
+    FILE *out = NULL;
+    static struct option long_options[] =
+    {
+        {"help", no_argument, 0, 'h'},
+        {"output", required_argument, 0, 'o'},
+        {"subset", required_argument, 0, 's'},
+        {0, 0, 0, 0}
+    };
+
+    while ((opt = getopt_long(argc, argv, "o:s:h", long_options, &option_index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'o':
+            strncpy(out_path, optarg, PACK_NAME_LEN);
+            break;
+        case 's':
+            subset = optarg;
+            break;
+        case 'h':
+        default:
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (strlen(out_path) == 0)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    for (f = FONT_MIN; f < FONT_MAX; f++)
+    {
+        pfont = font_get(f);
+        if (pack_font(pfont, subset, &pk[f]) != OK)
+        {
+            DEBUG_ERR(ERROR, "Can not pack font %dx%d!", pfont->width, pfont->height);
+            return 2;
+        }
+    }
+
+    out = fopen(out_path, "w");
+    if (out == NULL)
+    {
+        DEBUG_ERR(ERROR, "Can not create [%s]!", out_path);
+        return 2;
+    }
+
+    fprintf(out, "/*\n * font_packed.c:\n *\tGenerated by tools/font_pack.c from the bitmaps in font.c, do not edit.\n");
+    if (subset != NULL)
+    {
+        fprintf(out, " *\tSubset: %s\n", subset);
+    }
+    fprintf(out, " */\n#include \"font.h\"\n\n#if FONT_PACKED\n\n");
+
+    for (f = FONT_MIN; f < FONT_MAX; f++)
+    {
+        pack_write_font(out, font_get(f), &pk[f]);
+    }
+
+    fprintf(out, "font_t LED_FONT[FONT_MAX] =\n{\n");
+    for (f = FONT_MIN; f < FONT_MAX; f++)
+    {
+        pfont = font_get(f);
+        raw = pk[f].glyphs * pfont->height * pk[f].wbyte;
+        if (pk[f].raw)
+        {
+            fprintf(out, "    { FONT_%dX%d, %d, %d, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_%dX%d, NULL, NULL, 0 },\n",
+                    pfont->width, pfont->height, pfont->width, pfont->height, pfont->width, pfont->height);
+            packed = raw;
+        }
+        else
+        {
+            fprintf(out, "    { FONT_%dX%d, %d, %d, FNT_EN_ASCII_MIN, FNT_EN_ASCII_MAX, (uint8 *)FONT_EN_%dX%d_GLYPH, FONT_EN_%dX%d_ROWS, FONT_EN_%dX%d_OFFSET, %d },\n",
+                    pfont->width, pfont->height, pfont->width, pfont->height, pfont->width, pfont->height,
+                    pfont->width, pfont->height, pfont->width, pfont->height, pk[f].wide);
+            packed = pk[f].rows * pk[f].wbyte + pk[f].rec_len + pk[f].glyphs * (int32_t)sizeof(uint16);
+        }
+        raw_all += raw;
+        packed_all += packed;
+        printf("%2dx%-2d  raw %5d  packed %5d%s\r\n", pfont->width, pfont->height, raw, packed,
+               pk[f].raw ? "  (kept raw)" : "");
+    }
+    fprintf(out, "};\n\n#endif\n");
+    fclose(out);
+
+    printf("total  raw %5d  packed %5d\r\n", raw_all, packed_all);
+    return 0;
+}
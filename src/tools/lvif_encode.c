@@ -0,0 +1,791 @@
+/*
+ * lvif_encode.c:
+ *	Offline encoder: Y4M stream or PGM sequence -> LVIF clip.
+ *
+ *	Each frame is scaled to the panel size, then quantized (optionally
+ *	dithered) to 2bpp and packed in the panel's page-major layout by
+ *	dither_2bpp(), exactly as lcd_drv_bmp_speed() sends it. With -b 1 the
+ *	pages are then packed to 1bpp (8 rows per byte, dark grey and black
+ *	become black), the layout the panel takes in mono mode.
+ *	Frames are encoded by a pool of worker threads, one frame per task,
+ *	and written back in order by a dedicated writer thread.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <pthread.h>
+
+#include "../type.h"
+#include "../bmp.h"
+#include "../gray.h"
+#include "../dither.h"
+
+#define ENC_NAME_LEN (1024)
+#define ENC_THREAD_MAX (64)
+
+#define HELP_PRINT_FORMATS "  %-10s -- %s\r\n"
+
+typedef enum enc_input_e
+{
+    ENC_INPUT_Y4M = 0,
+    ENC_INPUT_PGM,
+} enc_input_t;
+
+typedef enum enc_slot_state_e
+{
+    ENC_SLOT_FREE = 0,
+    ENC_SLOT_READY,
+    ENC_SLOT_BUSY,
+    ENC_SLOT_DONE,
+} enc_slot_state_t;
+
+typedef struct enc_slot_s
+{
+    enc_slot_state_t state;
+    int32_t frame;
+    uint8_t *src; //8bit gray, src_width * src_height
+    uint8_t *mid; //8bit gray scaled, dst_width * dst_height
+    uint8_t *page; //packed 2bpp, only used for 1bpp output
+    uint8_t *dst; //packed pixel_bit, frame_len
+} enc_slot_t;
+
+typedef struct enc_ctx_s
+{
+    enc_input_t input;
+    FILE *in;
+    int8_t pattern[ENC_NAME_LEN + 1];
+    int32_t pgm_index;
+    int32_t y4m_chroma; //bytes of chroma to skip per frame
+
+    int32_t src_width;
+    int32_t src_height;
+    int32_t dst_width;
+    int32_t dst_height;
+    int32_t fps;
+    int32_t frame_len;
+    int32_t pixel_bit;
+    dither_mode_t dither;
+
+    int32_t *xmap; //dst column -> src column range, dst_width + 1 entries
+    int32_t *ymap; //dst row -> src row range, dst_height + 1 entries
+
+    FILE *out;
+    int64_t *index;
+    int32_t index_size;
+    int32_t write_index;
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    enc_slot_t *slots;
+    int32_t slot_num;
+    int32_t job_next;   //next frame a worker should pick up
+    int32_t write_next; //next frame the writer expects
+    int32_t read_total; //frames read so far
+    int32_t read_eof;
+    int32_t error;
+} enc_ctx_t;
+
+static void print_usage(const char *exe_name)
+{
+    printf("Usage: %s -i INPUT -o OUTPUT [options]\r\n", exe_name);
+    printf("Options:\r\n");
+    printf(HELP_PRINT_FORMATS, "-h,--help", "Show this help message.");
+    printf(HELP_PRINT_FORMATS, "-i INPUT,--input=INPUT", "Y4M file ('-' for stdin) or PGM pattern like 'frame_%04d.pgm'.");
+    printf(HELP_PRINT_FORMATS, "-o OUTPUT,--output=OUTPUT", "LVIF output file.");
+    printf(HELP_PRINT_FORMATS, "-W WIDTH,--width=WIDTH", "Panel width in pixels (default 192).");
+    printf(HELP_PRINT_FORMATS, "-H HEIGHT,--height=HEIGHT", "Panel height in pixels (default 96).");
+    printf(HELP_PRINT_FORMATS, "-r FPS,--fps=FPS", "Frame rate (default from Y4M header, else 25).");
+    printf(HELP_PRINT_FORMATS, "-n FIRST,--first=FIRST", "First PGM sequence number (default 0).");
+    printf(HELP_PRINT_FORMATS, "-j THREADS,--jobs=THREADS", "Worker threads (default online cpus).");
+    printf(HELP_PRINT_FORMATS, "-d MODE,--dither=MODE", "Dither mode: none, bayer, bluenoise, fs (default none).");
+    printf(HELP_PRINT_FORMATS, "-x,--index", "Append a frame index table (LVIX).");
+    printf(HELP_PRINT_FORMATS, "-b BITS,--bits=BITS", "Bits per pixel: 2 (4 gray levels, default) or 1 (mono).");
+    printf("\r\n");
+}
+
+/*
+ * Input readers
+ *********************************************************************************
+ */
+static int32_t y4m_open(enc_ctx_t *ctx, const char *path)
+{
+    char line[256] = {0};
+    char *tok = NULL;
+    int32_t num = 0, den = 0;
+    int32_t csize = 0;
+
+    ctx->in = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    if (ctx->in == NULL)
+    {
+        return ERROR;
+    }
+
+    if ((fgets(line, sizeof(line), ctx->in) == NULL) || (strncmp(line, "YUV4MPEG2", 9) != 0))
+    {
+        return ERROR;
+    }
+
+    //4:2:0 unless told otherwise
+    csize = 420;
+    for (tok = strtok(line + 9, " \n"); tok != NULL; tok = strtok(NULL, " \n"))
+    {
+        switch (tok[0])
+        {
+        case 'W':
+            ctx->src_width = atoi(tok + 1);
+            break;
+        case 'H':
+            ctx->src_height = atoi(tok + 1);
+            break;
+        case 'F':
+            if ((sscanf(tok + 1, "%d:%d", &num, &den) == 2) && (den > 0) && (ctx->fps <= 0))
+            {
+                ctx->fps = (num + den / 2) / den;
+            }
+            break;
+        case 'C':
+            if (strncmp(tok + 1, "mono", 4) == 0)
+                csize = 0;
+            else if (strncmp(tok + 1, "444alpha", 8) == 0)
+                csize = 4444;
+            else if (strncmp(tok + 1, "444", 3) == 0)
+                csize = 444;
+            else if (strncmp(tok + 1, "422", 3) == 0)
+                csize = 422;
+            break;
+        default:
+            break;
+        }
+    }
+
+    if ((ctx->src_width <= 0) || (ctx->src_height <= 0))
+    {
+        return ERROR;
+    }
+
+    switch (csize)
+    {
+    case 0:
+        ctx->y4m_chroma = 0;
+        break;
+    case 422:
+        ctx->y4m_chroma = ((ctx->src_width + 1) / 2) * ctx->src_height * 2;
+        break;
+    case 444:
+        ctx->y4m_chroma = ctx->src_width * ctx->src_height * 2;
+        break;
+    case 4444:
+        ctx->y4m_chroma = ctx->src_width * ctx->src_height * 3;
+        break;
+    case 420:
+    default:
+        ctx->y4m_chroma = ((ctx->src_width + 1) / 2) * ((ctx->src_height + 1) / 2) * 2;
+        break;
+    }
+
+    return OK;
+}
+
+static int32_t y4m_read(enc_ctx_t *ctx, uint8_t *gray)
+{
+    char line[256] = {0};
+    uint8_t skip[4096];
+    int32_t left = 0, n = 0;
+    size_t plane = (size_t)ctx->src_width * ctx->src_height;
+
+    if ((fgets(line, sizeof(line), ctx->in) == NULL) || (strncmp(line, "FRAME", 5) != 0))
+    {
+        return ERROR;
+    }
+
+    if (fread(gray, 1, plane, ctx->in) != plane)
+    {
+        return ERROR;
+    }
+
+    //chroma is not used, the panel is gray only
+    for (left = ctx->y4m_chroma; left > 0; left -= n)
+    {
+        n = (left > (int32_t)sizeof(skip)) ? (int32_t)sizeof(skip) : left;
+        if (fread(skip, 1, n, ctx->in) != (size_t)n)
+        {
+            return ERROR;
+        }
+    }
+
+    return OK;
+}
+
+static int32_t pgm_token(FILE *fp)
+{
+    int32_t c = 0, val = 0;
+
+    do
+    {
+        c = fgetc(fp);
+        if (c == '#')
+        {
+            while ((c != '\n') && (c != EOF))
+                c = fgetc(fp);
+        }
+    } while ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'));
+
+    if ((c < '0') || (c > '9'))
+    {
+        return ERROR;
+    }
+
+    while ((c >= '0') && (c <= '9'))
+    {
+        val = val * 10 + (c - '0');
+        c = fgetc(fp);
+    }
+
+    return val; //the single whitespace after the token is consumed
+}
+
+static int32_t pgm_read(enc_ctx_t *ctx, uint8_t *gray)
+{
+    char path[ENC_NAME_LEN + 32] = {0};
+    FILE *fp = NULL;
+    int32_t width = 0, height = 0, maxval = 0;
+    int32_t i = 0, bpp = 0;
+    size_t plane = 0;
+    uint8_t *row = NULL;
+    int32_t ret = ERROR;
+
+    snprintf(path, sizeof(path), (char *)ctx->pattern, ctx->pgm_index);
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        return ERROR;
+    }
+
+    if ((fgetc(fp) != 'P') || (fgetc(fp) != '5'))
+    {
+        goto out;
+    }
+
+    width = pgm_token(fp);
+    height = pgm_token(fp);
+    maxval = pgm_token(fp);
+    if ((width <= 0) || (height <= 0) || (maxval <= 0) || (maxval > 65535))
+    {
+        goto out;
+    }
+
+    if (gray == NULL)
+    {
+        //probe only
+        ctx->src_width = width;
+        ctx->src_height = height;
+        ret = OK;
+        goto out;
+    }
+
+    if ((width != ctx->src_width) || (height != ctx->src_height))
+    {
+        DEBUG_ERR(ERROR, "[%s] is %dx%d, expected %dx%d", path, width, height, ctx->src_width, ctx->src_height);
+        goto out;
+    }
+
+    plane = (size_t)width * height;
+    bpp = (maxval > 255) ? 2 : 1;
+    if (bpp == 1)
+    {
+        if (fread(gray, 1, plane, fp) != plane)
+            goto out;
+        if (maxval != 255)
+        {
+            for (i = 0; i < (int32_t)plane; i++)
+                gray[i] = (uint8_t)((gray[i] * 255 + maxval / 2) / maxval);
+        }
+    }
+    else
+    {
+        row = malloc(plane * 2);
+        if ((row == NULL) || (fread(row, 1, plane * 2, fp) != plane * 2))
+            goto out;
+        for (i = 0; i < (int32_t)plane; i++)
+            gray[i] = (uint8_t)((((row[i * 2] << 8) | row[i * 2 + 1]) * 255 + maxval / 2) / maxval);
+    }
+
+    ctx->pgm_index++;
+    ret = OK;
+out:
+    free(row);
+    fclose(fp);
+    return ret;
+}
+
+static int32_t enc_read(enc_ctx_t *ctx, uint8_t *gray)
+{
+    return (ctx->input == ENC_INPUT_Y4M) ? y4m_read(ctx, gray) : pgm_read(ctx, gray);
+}
+
+/*
+ * Frame encoder: box-filter scale, quantize to 4 levels, pack page-major.
+ *********************************************************************************
+ */
+static void enc_build_map(int32_t *map, int32_t src, int32_t dst)
+{
+    int32_t i = 0;
+
+    for (i = 0; i <= dst; i++)
+    {
+        map[i] = (int32_t)(((int64_t)i * src) / dst);
+    }
+}
+
+static uint8_t enc_sample(const enc_ctx_t *ctx, const uint8_t *gray, int32_t x, int32_t y)
+{
+    int32_t sx0 = ctx->xmap[x], sx1 = ctx->xmap[x + 1];
+    int32_t sy0 = ctx->ymap[y], sy1 = ctx->ymap[y + 1];
+    int32_t i = 0, j = 0;
+    uint32_t sum = 0, cnt = 0;
+    const uint8_t *row = NULL;
+
+    //upscaling maps several dst pixels onto one src pixel
+    sx1 = (sx1 <= sx0) ? (sx0 + 1) : sx1;
+    sy1 = (sy1 <= sy0) ? (sy0 + 1) : sy1;
+
+    for (j = sy0; j < sy1; j++)
+    {
+        row = gray + (size_t)j * ctx->src_width;
+        for (i = sx0; i < sx1; i++)
+        {
+            sum += row[i];
+        }
+    }
+    cnt = (uint32_t)(sx1 - sx0) * (uint32_t)(sy1 - sy0);
+
+    return (uint8_t)((sum + cnt / 2) / cnt);
+}
+
+/*
+ * Pack two 2bpp pages (4 rows each) into one 1bpp page, top pixel in bit 7.
+ * A pixel is set when its level is 2 or 3, the same rule the panel uses.
+ */
+static void enc_pack_1bpp(const uint8_t *page, int32_t width, int32_t height, uint8_t *out)
+{
+    int32_t p = 0, x = 0;
+    int32_t pages = (height + GRAY_PAGE_ROW - 1) / GRAY_PAGE_ROW;
+    uint8_t hi = 0, lo = 0;
+
+    for (p = 0; p < pages; p += 2)
+    {
+        for (x = 0; x < width; x++)
+        {
+            hi = page[p * width + x];
+            lo = ((p + 1) < pages) ? page[(p + 1) * width + x] : 0;
+            *out++ = (uint8_t)((hi & 0x80) | ((hi << 1) & 0x40) | ((hi << 2) & 0x20) | ((hi << 3) & 0x10) |
+                               ((lo >> 4) & 0x08) | ((lo >> 3) & 0x04) | ((lo >> 2) & 0x02) | ((lo >> 1) & 0x01));
+        }
+    }
+}
+
+static void enc_frame(const enc_ctx_t *ctx, const uint8_t *gray, uint8_t *mid, uint8_t *page, uint8_t *out)
+{
+    int32_t x = 0, y = 0;
+
+    for (y = 0; y < ctx->dst_height; y++)
+    {
+        for (x = 0; x < ctx->dst_width; x++)
+        {
+            mid[y * ctx->dst_width + x] = enc_sample(ctx, gray, x, y);
+        }
+    }
+
+    if (ctx->pixel_bit == 1)
+    {
+        dither_2bpp(ctx->dither, mid, ctx->dst_width, ctx->dst_width, ctx->dst_height, page, ctx->dst_width);
+        enc_pack_1bpp(page, ctx->dst_width, ctx->dst_height, out);
+        return;
+    }
+
+    dither_2bpp(ctx->dither, mid, ctx->dst_width, ctx->dst_width, ctx->dst_height, out, ctx->dst_width);
+}
+
+/*
+ * Thread pool: workers take frames in read order, the writer emits them in order.
+ *********************************************************************************
+ */
+static void *enc_worker(void *arg)
+{
+    enc_ctx_t *ctx = (enc_ctx_t *)arg;
+    enc_slot_t *slot = NULL;
+
+    pthread_mutex_lock(&ctx->lock);
+    for (;;)
+    {
+        slot = &ctx->slots[ctx->job_next % ctx->slot_num];
+        while (!ctx->error && !((slot->state == ENC_SLOT_READY) && (slot->frame == ctx->job_next)) &&
+               !(ctx->read_eof && (ctx->job_next >= ctx->read_total)))
+        {
+            pthread_cond_wait(&ctx->cond, &ctx->lock);
+            slot = &ctx->slots[ctx->job_next % ctx->slot_num];
+        }
+
+        if (ctx->error || (ctx->read_eof && (ctx->job_next >= ctx->read_total)))
+        {
+            break;
+        }
+
+        slot->state = ENC_SLOT_BUSY;
+        ctx->job_next++;
+        pthread_mutex_unlock(&ctx->lock);
+
+        enc_frame(ctx, slot->src, slot->mid, slot->page, slot->dst);
+
+        pthread_mutex_lock(&ctx->lock);
+        slot->state = ENC_SLOT_DONE;
+        pthread_cond_broadcast(&ctx->cond);
+    }
+    pthread_mutex_unlock(&ctx->lock);
+
+    return NULL;
+}
+
+static void *enc_writer(void *arg)
+{
+    enc_ctx_t *ctx = (enc_ctx_t *)arg;
+    enc_slot_t *slot = NULL;
+    int64_t offset = (int64_t)sizeof(lcd_img_hdr_t);
+    int64_t *index = NULL;
+
+    pthread_mutex_lock(&ctx->lock);
+    for (;;)
+    {
+        slot = &ctx->slots[ctx->write_next % ctx->slot_num];
+        while (!ctx->error && !((slot->state == ENC_SLOT_DONE) && (slot->frame == ctx->write_next)) &&
+               !(ctx->read_eof && (ctx->write_next >= ctx->read_total)))
+        {
+            pthread_cond_wait(&ctx->cond, &ctx->lock);
+        }
+
+        if (ctx->error || (ctx->read_eof && (ctx->write_next >= ctx->read_total)))
+        {
+            break;
+        }
+        pthread_mutex_unlock(&ctx->lock);
+
+        if (ctx->write_index)
+        {
+            if (ctx->write_next >= ctx->index_size)
+            {
+                ctx->index_size = (ctx->index_size == 0) ? 1024 : (ctx->index_size * 2);
+                index = realloc(ctx->index, ctx->index_size * sizeof(int64_t));
+                if (index == NULL)
+                {
+                    pthread_mutex_lock(&ctx->lock);
+                    ctx->error = ERROR;
+                    break;
+                }
+                ctx->index = index;
+            }
+            ctx->index[ctx->write_next] = offset;
+        }
+
+        if (fwrite(slot->dst, 1, ctx->frame_len, ctx->out) != (size_t)ctx->frame_len)
+        {
+            pthread_mutex_lock(&ctx->lock);
+            ctx->error = ERROR;
+            break;
+        }
+        offset += ctx->frame_len;
+
+        pthread_mutex_lock(&ctx->lock);
+        slot->state = ENC_SLOT_FREE;
+        ctx->write_next++;
+        pthread_cond_broadcast(&ctx->cond);
+    }
+    pthread_cond_broadcast(&ctx->cond);
+    pthread_mutex_unlock(&ctx->lock);
+
+    return NULL;
+}
+
+static int32_t enc_run(enc_ctx_t *ctx, int32_t threads)
+{
+    pthread_t workers[ENC_THREAD_MAX];
+    pthread_t writer;
+    enc_slot_t *slot = NULL;
+    int32_t i = 0, started = 0;
+    int32_t frame = 0;
+
+    //enough slots to keep every worker busy while the writer drains
+    ctx->slot_num = threads * 2 + 2;
+    ctx->slots = calloc(ctx->slot_num, sizeof(enc_slot_t));
+    if (ctx->slots == NULL)
+    {
+        return ERROR;
+    }
+
+    for (i = 0; i < ctx->slot_num; i++)
+    {
+        ctx->slots[i].src = malloc((size_t)ctx->src_width * ctx->src_height);
+        ctx->slots[i].mid = malloc((size_t)ctx->dst_width * ctx->dst_height);
+        ctx->slots[i].page = malloc(GRAY_FRAME_LEN(ctx->dst_width, ctx->dst_height));
+        ctx->slots[i].dst = malloc(ctx->frame_len);
+        if ((ctx->slots[i].src == NULL) || (ctx->slots[i].mid == NULL) || (ctx->slots[i].page == NULL) ||
+            (ctx->slots[i].dst == NULL))
+        {
+            return ERROR;
+        }
+    }
+
+    pthread_mutex_init(&ctx->lock, NULL);
+    pthread_cond_init(&ctx->cond, NULL);
+
+    if (pthread_create(&writer, NULL, enc_writer, ctx) != 0)
+    {
+        return ERROR;
+    }
+
+    for (started = 0; started < threads; started++)
+    {
+        if (pthread_create(&workers[started], NULL, enc_worker, ctx) != 0)
+        {
+            break;
+        }
+    }
+
+    for (frame = 0; started > 0; frame++)
+    {
+        slot = &ctx->slots[frame % ctx->slot_num];
+
+        pthread_mutex_lock(&ctx->lock);
+        while (!ctx->error && (slot->state != ENC_SLOT_FREE))
+        {
+            pthread_cond_wait(&ctx->cond, &ctx->lock);
+        }
+        pthread_mutex_unlock(&ctx->lock);
+
+        if (ctx->error || (enc_read(ctx, slot->src) != OK))
+        {
+            break;
+        }
+
+        pthread_mutex_lock(&ctx->lock);
+        slot->frame = frame;
+        slot->state = ENC_SLOT_READY;
+        ctx->read_total = frame + 1;
+        pthread_cond_broadcast(&ctx->cond);
+        pthread_mutex_unlock(&ctx->lock);
+    }
+
+    pthread_mutex_lock(&ctx->lock);
+    ctx->read_eof = 1;
+    if (started == 0)
+    {
+        ctx->error = ERROR;
+    }
+    pthread_cond_broadcast(&ctx->cond);
+    pthread_mutex_unlock(&ctx->lock);
+
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(workers[i], NULL);
+    }
+    pthread_join(writer, NULL);
+
+    for (i = 0; i < ctx->slot_num; i++)
+    {
+        free(ctx->slots[i].src);
+        free(ctx->slots[i].mid);
+        free(ctx->slots[i].page);
+        free(ctx->slots[i].dst);
+    }
+    free(ctx->slots);
+
+    return ctx->error;
+}
+
+static int32_t enc_finish(enc_ctx_t *ctx)
+{
+    lcd_img_hdr_t hdr = {0};
+    lcd_img_idx_t idx = {0};
+
+    if (ctx->write_index && (ctx->read_total > 0))
+    {
+        idx.flag = IMG_IDX_FLAG;
+        idx.frame_count = ctx->read_total;
+        idx.table_offset = (int64_t)sizeof(hdr) + (int64_t)ctx->read_total * ctx->frame_len;
+        if ((fwrite(ctx->index, sizeof(int64_t), ctx->read_total, ctx->out) != (size_t)ctx->read_total) ||
+            (fwrite(&idx, 1, sizeof(idx), ctx->out) != sizeof(idx)))
+        {
+            return ERROR;
+        }
+    }
+
+    hdr.flag = IMG_HDR_FLAG;
+    hdr.video_width = ctx->src_width;
+    hdr.video_height = ctx->src_height;
+    hdr.lcd_width = ctx->dst_width;
+    hdr.lcd_height = ctx->dst_height;
+    hdr.video_fps = ctx->fps;
+    hdr.video_frame = ctx->read_total;
+    hdr.pixel_bit = ctx->pixel_bit;
+
+    //the frame count is only known now, rewrite the header
+    if ((fseek(ctx->out, 0, SEEK_SET) != 0) || (fwrite(&hdr, 1, sizeof(hdr), ctx->out) != sizeof(hdr)))
+    {
+        return ERROR;
+    }
+
+    return OK;
+}
+
+int main(int argc, char **argv)
+{
+    int ecode = 0;
+    int opt = 0;
+    int option_index = 0;
+    char in_path[ENC_NAME_LEN + 1] = {0};
+    char out_path[ENC_NAME_LEN + 1] = {0};
+    int threads = 0;
+    lcd_img_hdr_t hdr = {0};
+    enc_ctx_t ctx;
+    static struct option long_options[] =
+    {
+        {"help", no_argument, 0, 'h'},
+        {"input", required_argument, 0, 'i'},
+        {"output", required_argument, 0, 'o'},
+        {"width", required_argument, 0, 'W'},
+        {"height", required_argument, 0, 'H'},
+        {"fps", required_argument, 0, 'r'},
+        {"first", required_argument, 0, 'n'},
+        {"jobs", required_argument, 0, 'j'},
+        {"dither", required_argument, 0, 'd'},
+        {"index", no_argument, 0, 'x'},
+        {"bits", required_argument, 0, 'b'},
+        {0, 0, 0, 0}
+    };
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.dst_width = 192;
+    ctx.dst_height = 96;
+    ctx.pixel_bit = GRAY_PIXEL_BIT;
+
+    while ((opt = getopt_long(argc, argv, "i:o:W:H:r:n:j:d:xb:h", long_options, &option_index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'i':
+            strncpy(in_path, optarg, ENC_NAME_LEN);
+            break;
+        case 'o':
+            strncpy(out_path, optarg, ENC_NAME_LEN);
+            break;
+        case 'W':
+            ctx.dst_width = atoi(optarg);
+            break;
+        case 'H':
+            ctx.dst_height = atoi(optarg);
+            break;
+        case 'r':
+            ctx.fps = atoi(optarg);
+            break;
+        case 'n':
+            ctx.pgm_index = atoi(optarg);
+            break;
+        case 'j':
+            threads = atoi(optarg);
+            break;
+        case 'd':
+            ctx.dither = dither_mode_from_name(optarg);
+            break;
+        case 'x':
+            ctx.write_index = 1;
+            break;
+        case 'b':
+            ctx.pixel_bit = atoi(optarg);
+            break;
+        case 'h':
+        default:
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((strlen(in_path) == 0) || (strlen(out_path) == 0) || (ctx.dst_width <= 0) || (ctx.dst_height <= 0) ||
+        (ctx.dither >= DITHER_MAX) || ((ctx.pixel_bit != 1) && (ctx.pixel_bit != GRAY_PIXEL_BIT)))
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    if (threads <= 0)
+    {
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    threads = (threads <= 0) ? 1 : ((threads > ENC_THREAD_MAX) ? ENC_THREAD_MAX : threads);
+
+    if (strchr(in_path, '%') != NULL)
+    {
+        ctx.input = ENC_INPUT_PGM;
+        strncpy((char *)ctx.pattern, in_path, ENC_NAME_LEN);
+        if (pgm_read(&ctx, NULL) != OK)
+        {
+            DEBUG_ERR(ERROR, "Can not open PGM sequence [%s]!", in_path);
+            return 2;
+        }
+    }
+    else
+    {
+        ctx.input = ENC_INPUT_Y4M;
+        if (y4m_open(&ctx, in_path) != OK)
+        {
+            DEBUG_ERR(ERROR, "Invalid Y4M input [%s]!", in_path);
+            return 2;
+        }
+    }
+
+    ctx.fps = (ctx.fps > 0) ? ctx.fps : 25;
+    ctx.frame_len = (ctx.pixel_bit == 1) ? (((ctx.dst_height + 7) / 8) * ctx.dst_width) : GRAY_FRAME_LEN(ctx.dst_width, ctx.dst_height);
+    ctx.xmap = malloc((ctx.dst_width + 1) * sizeof(int32_t));
+    ctx.ymap = malloc((ctx.dst_height + 1) * sizeof(int32_t));
+    if ((ctx.xmap == NULL) || (ctx.ymap == NULL))
+    {
+        return 2;
+    }
+    enc_build_map(ctx.xmap, ctx.src_width, ctx.dst_width);
+    enc_build_map(ctx.ymap, ctx.src_height, ctx.dst_height);
+
+    ctx.out = fopen(out_path, "wb");
+    if (ctx.out == NULL)
+    {
+        DEBUG_ERR(ERROR, "Can not create [%s]!", out_path);
+        return 2;
+    }
+
+    //placeholder, rewritten once the frame count is known
+    if (fwrite(&hdr, 1, sizeof(hdr), ctx.out) != sizeof(hdr))
+    {
+        ecode = 2;
+        goto error;
+    }
+
+    DEBUG_LOG("Encode [%s] %dx%d -> [%s] %dx%d@%dfps, %d threads.", in_path, ctx.src_width, ctx.src_height,
+              out_path, ctx.dst_width, ctx.dst_height, ctx.fps, threads);
+
+    if ((enc_run(&ctx, threads) != OK) || (ctx.read_total == 0) || (enc_finish(&ctx) != OK))
+    {
+        DEBUG_ERR(ERROR, "Encode failed after [%d] frames!", ctx.read_total);
+        ecode = 2;
+        goto error;
+    }
+
+    DEBUG_LOG("Encoded [%d] frames, [%d] bytes per frame.", ctx.read_total, ctx.frame_len);
+error:
+    fclose(ctx.out);
+    if ((ctx.in != NULL) && (ctx.in != stdin))
+    {
+        fclose(ctx.in);
+    }
+    free(ctx.index);
+    free(ctx.xmap);
+    free(ctx.ymap);
+    return ecode;
+}
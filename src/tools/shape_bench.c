@@ -0,0 +1,266 @@
+/*
+ * shape_bench.c:
+ *	Filled circle/ellipse benchmark: the span fill in lcd.c against the
+ *	previous line based fill, kept here as legacy_circle()/legacy_ellipse().
+ *
+ *	The legacy fill draws one lcd_line() per octant pair, so rows near the
+ *	middle are written several times. "writes" is the number of pixel
+ *	writes: lcd_line() lengths for the legacy fill, the pixels of the shape
+ *	for the span fill, which writes every row once. Only the framebuffer is
+ *	touched, the panel is not initialised.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+
+#include "../type.h"
+#include "../lcd.h"
+#include "../lcd192x96.h"
+
+#define BENCH_LOOP (2000)
+#define BENCH_COLOUR (3)
+
+#define HELP_PRINT_FORMATS "  %-10s -- %s\r\n"
+
+typedef struct bench_shape_s
+{
+    const char *name;
+    int32_t ellipse;
+    int32_t x;
+    int32_t y;
+    int32_t rx;
+    int32_t ry;
+} bench_shape_t;
+
+static const bench_shape_t BENCH_SHAPE[] =
+{
+    {"circle r8", 0, 96, 48, 8, 8},
+    {"circle r24", 0, 96, 48, 24, 24},
+    {"circle r47", 0, 96, 48, 47, 47},
+    {"circle r60 clip", 0, 20, 20, 60, 60},
+    {"ellipse 20x10", 1, 96, 48, 20, 10},
+    {"ellipse 60x30", 1, 96, 48, 60, 30},
+    {"ellipse 95x47", 1, 96, 48, 95, 47},
+};
+
+static int64_t LEGACY_WRITES = 0;
+
+static int64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static void legacy_line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t colour)
+{
+    int32_t dx = abs(x1 - x0);
+    int32_t dy = abs(y1 - y0);
+
+    LEGACY_WRITES += ((dx > dy) ? dx : dy) + 1;
+    lcd_line(x0, y0, x1, y1, colour);
+}
+
+static void legacy_circle(int32_t x, int32_t y, int32_t r, int32_t colour)
+{
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -2 * r;
+    int32_t f = 1 - r;
+    int32_t x1 = 0;
+    int32_t y1 = r;
+
+    legacy_line(x, y + r, x, y - r, colour);
+    legacy_line(x + r, y, x - r, y, colour);
+
+    while (x1 < y1)
+    {
+        if (f >= 0)
+        {
+            y1--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x1++;
+        ddF_x += 2;
+        f += ddF_x;
+        legacy_line(x + x1, y + y1, x - x1, y + y1, colour);
+        legacy_line(x + x1, y - y1, x - x1, y - y1, colour);
+        legacy_line(x + y1, y + x1, x - y1, y + x1, colour);
+        legacy_line(x + y1, y - x1, x - y1, y - x1, colour);
+    }
+}
+
+static void legacy_ellipse(int32_t cx, int32_t cy, int32_t xRadius, int32_t yRadius, int32_t colour)
+{
+    int32_t x, y;
+    int32_t xChange, yChange, ellipseError;
+    int32_t twoAsquare, twoBsquare;
+    int32_t stoppingX, stoppingY;
+
+    twoAsquare = 2 * xRadius * xRadius;
+    twoBsquare = 2 * yRadius * yRadius;
+
+    x = xRadius;
+    y = 0;
+    xChange = yRadius * yRadius * (1 - 2 * xRadius);
+    yChange = xRadius * xRadius;
+    ellipseError = 0;
+    stoppingX = twoBsquare * xRadius;
+    stoppingY = 0;
+
+    while (stoppingX >= stoppingY)
+    {
+        legacy_line(cx + x, cy + y, cx - x, cy + y, colour);
+        legacy_line(cx - x, cy - y, cx + x, cy - y, colour);
+        ++y;
+        stoppingY += twoAsquare;
+        ellipseError += yChange;
+        yChange += twoAsquare;
+
+        if ((2 * ellipseError + xChange) > 0)
+        {
+            --x;
+            stoppingX -= twoBsquare;
+            ellipseError += xChange;
+            xChange += twoBsquare;
+        }
+    }
+
+    x = 0;
+    y = yRadius;
+    xChange = yRadius * yRadius;
+    yChange = xRadius * xRadius * (1 - 2 * yRadius);
+    ellipseError = 0;
+    stoppingX = 0;
+    stoppingY = twoAsquare * yRadius;
+
+    while (stoppingX <= stoppingY)
+    {
+        legacy_line(cx + x, cy + y, cx - x, cy + y, colour);
+        legacy_line(cx - x, cy - y, cx + x, cy - y, colour);
+        ++x;
+        stoppingX += twoBsquare;
+        ellipseError += xChange;
+        xChange += twoBsquare;
+
+        if ((2 * ellipseError + yChange) > 0)
+        {
+            --y;
+            stoppingY -= twoAsquare;
+            ellipseError += yChange;
+            yChange += twoAsquare;
+        }
+    }
+}
+
+static void bench_draw(const bench_shape_t *s, int32_t legacy)
+{
+    if (legacy)
+    {
+        if (s->ellipse)
+            legacy_ellipse(s->x, s->y, s->rx, s->ry, BENCH_COLOUR);
+        else
+            legacy_circle(s->x, s->y, s->rx, BENCH_COLOUR);
+    }
+    else
+    {
+        if (s->ellipse)
+            lcd_ellipse(s->x, s->y, s->rx, s->ry, BENCH_COLOUR, 1);
+        else
+            lcd_circle(s->x, s->y, s->rx, BENCH_COLOUR, 1);
+    }
+}
+
+static int64_t bench_pixels(void)
+{
+    int32_t x = 0, y = 0;
+    int64_t n = 0;
+
+    for (y = 0; y < LCD_MAX_Y; y++)
+    {
+        for (x = 0; x < LCD_MAX_X; x++)
+        {
+            n += (lcd_get_point(x, y) == BENCH_COLOUR);
+        }
+    }
+
+    return n;
+}
+
+static double bench_time_us(const bench_shape_t *s, int32_t legacy, int32_t loop)
+{
+    int64_t t0 = 0;
+    int32_t i = 0;
+
+    t0 = bench_now_ns();
+    for (i = 0; i < loop; i++)
+    {
+        bench_draw(s, legacy);
+    }
+
+    return (double)(bench_now_ns() - t0) / 1000.0 / loop;
+}
+
+static void print_usage(char *name)
+{
+    printf("Usage: %s [options]\r\n", name);
+    printf(HELP_PRINT_FORMATS, "-n --loop", "draws per shape and method, default 2000");
+    printf(HELP_PRINT_FORMATS, "-h --help", "this help");
+}
+
+int main(int argc, char **argv)
+{
+    int opt = 0;
+    int option_index = 0;
+    int32_t loop = BENCH_LOOP;
+    int32_t i = 0, same = 0;
+    int64_t legacy_writes = 0, span_writes = 0;
+    double legacy_us = 0, span_us = 0;
+    static uint8_t legacy_fb[LCD_DRV_PAGE_MAX * LCD_DRV_MAX_X];
+    static struct option long_options[] =
+    {
+        {"help", no_argument, 0, 'h'},
+        {"loop", required_argument, 0, 'n'},
+        {0, 0, 0, 0}
+    };
+
+    while ((opt = getopt_long(argc, argv, "n:h", long_options, &option_index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            loop = atoi(optarg);
+            loop = (loop < 1) ? 1 : loop;
+            break;
+        case 'h':
+        default:
+            print_usage(argv[0]);
+            return 0;
+        }
+    }
+
+    printf("%-16s %10s %10s %10s %10s %s\r\n", "shape", "old-writes", "new-writes", "old-us", "new-us", "output");
+    for (i = 0; i < (int32_t)(sizeof(BENCH_SHAPE) / sizeof(BENCH_SHAPE[0])); i++)
+    {
+        lcd_clear(0);
+        LEGACY_WRITES = 0;
+        bench_draw(&BENCH_SHAPE[i], 1);
+        legacy_writes = LEGACY_WRITES;
+        memcpy(legacy_fb, lcd_drv_get_buffer(), sizeof(legacy_fb));
+
+        lcd_clear(0);
+        bench_draw(&BENCH_SHAPE[i], 0);
+        span_writes = bench_pixels();
+        same = (memcmp(legacy_fb, lcd_drv_get_buffer(), sizeof(legacy_fb)) == 0);
+
+        legacy_us = bench_time_us(&BENCH_SHAPE[i], 1, loop);
+        span_us = bench_time_us(&BENCH_SHAPE[i], 0, loop);
+
+        printf("%-16s %10lld %10lld %10.2f %10.2f %s\r\n", BENCH_SHAPE[i].name, (long long)legacy_writes,
+               (long long)span_writes, legacy_us, span_us, same ? "same" : "DIFFERENT");
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * simd_check.c:
+ *	Check the SIMD kernels of gray.c and dither.c (NEON on ARM, SSE2/SSSE3
+ *	on x86) against the C implementation from simd_ref.c: quantize+pack,
+ *	every dither mode and the level LUT, on random pictures of every width
+ *	up to the panel width so the SIMD blocks and the C tail both run.
+ *	Run it on the target after changing the kernels or the compiler flags.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../type.h"
+#include "../gray.h"
+#include "../dither.h"
+
+#define CHECK_W (192)
+#define CHECK_H (96)
+#define CHECK_PAGES ((CHECK_H + GRAY_PAGE_ROW - 1) / GRAY_PAGE_ROW)
+#define CHECK_LOOP (2000)
+
+extern void ref_gray_pack_2bpp(const uint8_t *src, int32_t stride, int32_t width, int32_t height, uint8_t *dst);
+extern void ref_gray_lut_build(const uint8_t map[4], int32_t invert, gray_lut_t *lut);
+extern void ref_gray_lut_apply(const gray_lut_t *lut, const uint8_t *src, uint8_t *dst, int32_t len);
+extern int32_t ref_dither_2bpp(dither_mode_t mode, const uint8_t *src, int32_t stride, int32_t width, int32_t height,
+                               uint8_t *dst, int32_t dst_stride);
+
+static uint8_t SRC[CHECK_W * CHECK_H];
+static uint8_t OUT[CHECK_PAGES * CHECK_W];
+static uint8_t REF[CHECK_PAGES * CHECK_W];
+
+static int32_t check_same(const char *name, int32_t width, int32_t height, int32_t len)
+{
+    if (memcmp(OUT, REF, len) == 0)
+    {
+        return 0;
+    }
+
+    printf("%s differs at %dx%d\r\n", name, width, height);
+    return 1;
+}
+
+int main(void)
+{
+    int32_t i = 0, k = 0, width = 0, height = 0, len = 0, bad = 0;
+    dither_mode_t mode = DITHER_NONE;
+    char name[32] = {0};
+    uint8_t map[4];
+    gray_lut_t lut, ref_lut;
+
+    srand(1);
+    for (i = 0; i < CHECK_LOOP; i++)
+    {
+        width = 1 + (i % CHECK_W);
+        height = 1 + rand() % CHECK_H;
+        len = ((height + GRAY_PAGE_ROW - 1) / GRAY_PAGE_ROW) * width;
+        for (k = 0; k < width * height; k++)
+        {
+            //一部分取阈值附近的值
+            SRC[k] = (rand() % 4) ? (uint8_t)rand() : (uint8_t)(42 + rand() % 3 - 1 + (rand() % 3) * 85);
+        }
+
+        gray_pack_2bpp(SRC, width, width, height, OUT);
+        ref_gray_pack_2bpp(SRC, width, width, height, REF);
+        bad += check_same("gray_pack_2bpp", width, height, len);
+
+        for (mode = DITHER_NONE; mode < DITHER_MAX; mode++)
+        {
+            dither_2bpp(mode, SRC, width, width, height, OUT, width);
+            ref_dither_2bpp(mode, SRC, width, width, height, REF, width);
+            snprintf(name, sizeof(name), "dither_2bpp mode %d", (int)mode);
+            bad += check_same(name, width, height, len);
+        }
+
+        for (k = 0; k < 4; k++)
+        {
+            map[k] = (uint8_t)(rand() % 4);
+        }
+        gray_lut_build(map, i & 1, &lut);
+        ref_gray_lut_build(map, i & 1, &ref_lut);
+        memcpy(SRC, REF, len);
+        gray_lut_apply(&lut, SRC, OUT, len);
+        ref_gray_lut_apply(&ref_lut, SRC, REF, len);
+        bad += check_same("gray_lut_apply", width, height, len);
+    }
+
+    printf("%d cases, %d differ\r\n", CHECK_LOOP, bad);
+    return (bad == 0) ? 0 : 1;
+}
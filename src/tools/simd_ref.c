@@ -0,0 +1,14 @@
+/*
+ * simd_ref.c:
+ *	gray.c and dither.c built again without SIMD and with ref_ names,
+ *	the reference simd_check.c compares the SIMD build against.
+ */
+#define GRAY_NO_SIMD 1
+#define gray_pack_2bpp ref_gray_pack_2bpp
+#define gray_lut_build ref_gray_lut_build
+#define gray_lut_apply ref_gray_lut_apply
+#define dither_2bpp ref_dither_2bpp
+#define dither_mode_from_name ref_dither_mode_from_name
+
+#include "../gray.c"
+#include "../dither.c"